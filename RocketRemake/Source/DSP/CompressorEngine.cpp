@@ -0,0 +1,200 @@
+#include "CompressorEngine.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+    constexpr float kDbPerOctave = 6.0205999f; // 20 * log10(2)
+    constexpr float kMinLevel = 1.0e-9f;        // -180 dBFS, keeps the detector away from log(0)
+    constexpr int kTableBits = 8;
+    constexpr int kTableSize = 1 << kTableBits;
+
+    // log2(1 + m) and 2^f over [0, 1], kTableSize segments each, linearly interpolated
+    struct DbTables
+    {
+        DbTables()
+        {
+            for (int i = 0; i <= kTableSize; ++i)
+            {
+                const double x = (double) i / (double) kTableSize;
+                log2Mantissa[(size_t) i] = (float) std::log2(1.0 + x);
+                exp2Fraction[(size_t) i] = (float) std::exp2(x);
+            }
+        }
+
+        std::array<float, kTableSize + 1> log2Mantissa {};
+        std::array<float, kTableSize + 1> exp2Fraction {};
+    };
+
+    const DbTables dbTables;
+
+    // x > 0 and normal. Exponent from the float bits, mantissa from the table.
+    inline float fastLog2(float x) noexcept
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+
+        const int exponent = (int) ((bits >> 23) & 0xffu) - 127;
+        const std::uint32_t mantissa = bits & 0x7fffffu;
+        const int index = (int) (mantissa >> (23 - kTableBits));
+        const float frac = (float) (mantissa & ((1u << (23 - kTableBits)) - 1u)) * (1.0f / (float) (1u << (23 - kTableBits)));
+
+        const auto& t = dbTables.log2Mantissa;
+        return (float) exponent + t[(size_t) index] + frac * (t[(size_t) index + 1] - t[(size_t) index]);
+    }
+
+    // y in [-126, 127]. Integer part goes straight into the float exponent.
+    inline float fastExp2(float y) noexcept
+    {
+        int whole = (int) y;
+        if (y < (float) whole)
+            --whole;
+
+        const float position = (y - (float) whole) * (float) kTableSize;
+        const int index = juce::jmin((int) position, kTableSize - 1);
+        const float frac = position - (float) index;
+
+        const auto& t = dbTables.exp2Fraction;
+        const float mantissa = t[(size_t) index] + frac * (t[(size_t) index + 1] - t[(size_t) index]);
+
+        const std::uint32_t scaleBits = (std::uint32_t) (juce::jlimit(-126, 127, whole) + 127) << 23;
+        float scale;
+        std::memcpy(&scale, &scaleBits, sizeof(scale));
+        return scale * mantissa;
+    }
+
+    inline float timeToCoefficient(float ms, double sampleRate) noexcept
+    {
+        return ms <= 0.0f ? 0.0f : std::exp(-1.0f / (ms * 0.001f * (float) sampleRate));
+    }
+}
+
+void CompressorEngine::prepare(double newSampleRate, int newMaxBlockSize, int newNumChannels)
+{
+    sampleRate = newSampleRate;
+    maxBlockSize = juce::jmax(1, newMaxBlockSize);
+    numChannels = juce::jmax(1, newNumChannels);
+
+    gains.assign((size_t) maxBlockSize, 1.0f);
+
+    maxLookaheadSamples = (int) std::ceil(kMaxLookaheadMs * 0.001 * sampleRate);
+    lookaheadLine.setSize(numChannels, juce::jmax(1, maxLookaheadSamples));
+    lookaheadSamples = juce::jmin(lookaheadSamples, maxLookaheadSamples);
+
+    reset();
+}
+
+void CompressorEngine::reset() noexcept
+{
+    reductionDb = 0.0f;
+    lookaheadLine.clear();
+    lookaheadPos = 0;
+}
+
+void CompressorEngine::setParameters(float threshold, float ratio, float attackMs, float releaseMs, float knee) noexcept
+{
+    thresholdDb = threshold;
+    slope = 1.0f - 1.0f / juce::jmax(1.0f, ratio);
+    kneeDb = juce::jmax(0.0f, knee);
+    attackCoef = timeToCoefficient(attackMs, sampleRate);
+    releaseCoef = timeToCoefficient(releaseMs, sampleRate);
+}
+
+void CompressorEngine::setInOutGain(float inDb, float outDb) noexcept
+{
+    inGain = juce::Decibels::decibelsToGain(inDb);
+    makeupGain = inGain * juce::Decibels::decibelsToGain(outDb);
+}
+
+void CompressorEngine::setLookahead(float milliseconds) noexcept
+{
+    const int samples = juce::jlimit(0, maxLookaheadSamples, juce::roundToInt(milliseconds * 0.001 * sampleRate));
+    if (samples == lookaheadSamples)
+        return;
+
+    lookaheadSamples = samples;
+    lookaheadLine.clear();
+    lookaheadPos = 0;
+}
+
+float CompressorEngine::computeReductionDb(float levelDb) const noexcept
+{
+    const float over = levelDb - thresholdDb;
+
+    if (kneeDb > 0.0f)
+    {
+        if (2.0f * over <= -kneeDb)
+            return 0.0f;
+        if (2.0f * over < kneeDb)
+        {
+            const float x = over + 0.5f * kneeDb;
+            return slope * x * x / (2.0f * kneeDb);
+        }
+        return slope * over;
+    }
+
+    return over > 0.0f ? slope * over : 0.0f;
+}
+
+void CompressorEngine::process(juce::AudioBuffer<float>& buffer) noexcept
+{
+    const int channels = juce::jmin(buffer.getNumChannels(), numChannels);
+    if (channels <= 0 || gains.empty())
+        return;
+
+    for (int start = 0; start < buffer.getNumSamples(); start += maxBlockSize)
+        processChunk(buffer, start, juce::jmin(maxBlockSize, buffer.getNumSamples() - start), channels);
+}
+
+void CompressorEngine::processChunk(juce::AudioBuffer<float>& buffer, int start, int numSamples, int channels) noexcept
+{
+    const float* left = buffer.getReadPointer(0, start);
+    const float* right = buffer.getReadPointer(juce::jmin(1, channels - 1), start);
+
+    // Detector and gain computer: one linked level per sample, gain reduction smoothed in dB
+    for (int i = 0; i < numSamples; ++i)
+    {
+        float peak = juce::jmax(std::abs(left[i]), std::abs(right[i]));
+        for (int ch = 2; ch < channels; ++ch)
+            peak = juce::jmax(peak, std::abs(buffer.getReadPointer(ch, start)[i]));
+
+        const float levelDb = kDbPerOctave * fastLog2(juce::jmax(kMinLevel, peak * inGain));
+        const float target = computeReductionDb(levelDb);
+        const float coef = target > reductionDb ? attackCoef : releaseCoef;
+        reductionDb = target + coef * (reductionDb - target);
+
+        gains[(size_t) i] = fastExp2(-reductionDb * (1.0f / kDbPerOctave));
+    }
+
+    // Gain application: vectorised multiplies, input/output gain folded in
+    juce::FloatVectorOperations::multiply(gains.data(), makeupGain, numSamples);
+
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        float* data = buffer.getWritePointer(ch, start);
+        if (lookaheadSamples > 0)
+            delayChunk(data, ch, numSamples);
+        juce::FloatVectorOperations::multiply(data, gains.data(), numSamples);
+    }
+
+    if (lookaheadSamples > 0)
+        lookaheadPos = (lookaheadPos + numSamples) % lookaheadSamples;
+}
+
+// Swaps the chunk through the lookahead line: data comes out lookaheadSamples late.
+void CompressorEngine::delayChunk(float* data, int channel, int numSamples) noexcept
+{
+    float* line = lookaheadLine.getWritePointer(channel);
+    int pos = lookaheadPos;
+    int done = 0;
+
+    while (done < numSamples)
+    {
+        const int run = juce::jmin(numSamples - done, lookaheadSamples - pos);
+        std::swap_ranges(data + done, data + done + run, line + pos);
+        done += run;
+        pos = (pos + run) % lookaheadSamples;
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+// =============================================================================
+// CompressorEngine - stereo-linked feed-forward compressor
+//
+// One detector for all channels (peak of the loudest channel), a dB-domain gain
+// computer with an optional soft knee, and attack/release smoothing of the gain
+// reduction. The per-sample dB conversions go through small lookup tables
+// instead of log/exp. Detection writes one gain per sample into a block
+// buffer; a second pass applies it to every channel with FloatVectorOperations,
+// with the input and output gains folded in. With lookahead, the audio is
+// delayed while the detector sees the undelayed input, and the engine reports
+// the delay as latency. prepare() allocates everything; process() never does.
+// =============================================================================
+class CompressorEngine
+{
+public:
+    static constexpr float kMaxLookaheadMs = 10.0f;
+
+    void prepare(double sampleRate, int maxBlockSize, int numChannels);
+    void reset() noexcept;
+
+    void setParameters(float thresholdDb, float ratio, float attackMs, float releaseMs, float kneeDb = 0.0f) noexcept;
+    void setInOutGain(float inDb, float outDb) noexcept;
+
+    // 0 disables lookahead. Changing it clears the lookahead line.
+    void setLookahead(float milliseconds) noexcept;
+    int getLatencySamples() const noexcept { return lookaheadSamples; }
+    int getMaxLatencySamples() const noexcept { return maxLookaheadSamples; }
+
+    // In place; uses at most the number of channels given to prepare().
+    void process(juce::AudioBuffer<float>& buffer) noexcept;
+
+    // Current gain reduction in dB (>= 0), for metering.
+    float getGainReductionDb() const noexcept { return reductionDb; }
+
+private:
+    void processChunk(juce::AudioBuffer<float>& buffer, int start, int numSamples, int channels) noexcept;
+    void delayChunk(float* data, int channel, int numSamples) noexcept;
+    float computeReductionDb(float levelDb) const noexcept;
+
+    double sampleRate = 44100.0;
+    int maxBlockSize = 0;
+    int numChannels = 0;
+
+    float thresholdDb = 0.0f;
+    float slope = 0.0f; // 1 - 1/ratio
+    float kneeDb = 0.0f;
+    float attackCoef = 0.0f;
+    float releaseCoef = 0.0f;
+    float inGain = 1.0f;
+    float makeupGain = 1.0f; // in * out, applied with the reduction
+
+    float reductionDb = 0.0f; // smoothed, >= 0
+
+    std::vector<float> gains; // per-sample gain of the current chunk
+
+    juce::AudioBuffer<float> lookaheadLine;
+    int lookaheadSamples = 0;
+    int maxLookaheadSamples = 0;
+    int lookaheadPos = 0;
+};
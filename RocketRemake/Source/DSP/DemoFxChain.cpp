@@ -38,10 +38,114 @@ namespace
 }
 
 DemoFxChain::DemoFxChain(juce::AudioProcessorValueTreeState& state)
-    : apvts(state)
+    : apvts(state), params(makeParamHandles(state))
 {
 }
 
+DemoFxChain::ParamHandles DemoFxChain::makeParamHandles(juce::AudioProcessorValueTreeState& state)
+{
+    const auto param = [&state](const juce::String& id) { return FxParam(state, id); };
+
+    const auto makeEq = [&param](const juce::String& prefix)
+    {
+        EqParams eq;
+        eq.enable = param(prefix + "Enable");
+        eq.lowCut = param(prefix + "LowCut");
+        eq.highCut = param(prefix + "HighCut");
+        for (int b = 0; b < 4; ++b)
+        {
+            const auto s = juce::String(b + 1);
+            eq.frequency[(size_t) b] = param(prefix + "Frequency" + s);
+            eq.gain[(size_t) b] = param(prefix + "Gain" + s);
+            eq.quality[(size_t) b] = param(prefix + "Quality" + s);
+        }
+        return eq;
+    };
+
+    const auto makeComp = [&param](const juce::String& prefix)
+    {
+        CompParams c;
+        c.enable = param(prefix + "Enable");
+        c.threshold = param(prefix + "Threshold");
+        c.ratio = param(prefix + "Ratio");
+        c.attack = param(prefix + "Attack");
+        c.release = param(prefix + "Release");
+        c.inGain = param(prefix + "InGain");
+        c.outGain = param(prefix + "OutGain");
+        c.lookahead = param(prefix + "Lookahead");
+        return c;
+    };
+
+    const auto makeDelay = [&param](int number)
+    {
+        const auto s = juce::String(number);
+        DelayParams d;
+        d.enable = param("delayEnable" + s);
+        d.type = param("delayType" + s);
+        d.sync = param("delaySync" + s);
+        d.rhythm = param("delayRhythm" + s);
+        d.time = param("delayTime" + s);
+        d.feedback = param("delayFeedback" + s);
+        d.mix = param("delayMix" + s);
+        d.hp = param("delayHP" + s);
+        d.lp = param("delayLP" + s);
+        d.lfoRate = param("delayLfoRate" + s);
+        d.lfoDepth = param("delayLfoDepth" + s);
+        return d;
+    };
+
+    ParamHandles p;
+    p.amount = param("amount");
+    p.inGain = param("inGain");
+    p.outGain = param("outGain");
+
+    p.preEq = makeEq("preEQ");
+    p.postEq = makeEq("postEQ");
+    p.preComp = makeComp("preCompressor");
+    p.postComp = makeComp("postCompressor");
+
+    p.deesserEnable = param("deesserEnable");
+    p.deesserFrequency = param("deesserFrequency");
+    p.deesserThreshold = param("deesserThreshold");
+
+    p.delays = { makeDelay(1), makeDelay(2) };
+
+    p.distortionEnable = param("distortionEnable");
+    p.distortionDrive1 = param("distortionDrive1");
+    p.distortionDrive2 = param("distortionDrive2");
+    p.distortionMix1 = param("distortionMix1");
+    p.distortionMix2 = param("distortionMix2");
+
+    p.phaserEnable = param("phaserEnable");
+    p.phaserFrequency = param("phaserFrequency");
+    p.phaserIntensity = param("phaserIntensity");
+    p.phaserDepth = param("phaserDepth");
+    p.phaserMix = param("phaserMix");
+
+    p.flangerEnable = param("flangerEnable");
+    p.flangerFrequency = param("flangerFrequency");
+    p.flangerIntensity = param("flangerIntensity");
+    p.flangerFeedback = param("flangerFeedback");
+    p.flangerMix = param("flangerMix");
+
+    p.bitCrushDepth = param("bitCrushDepth");
+    p.bitCrushFrequency = param("bitCrushFrequency");
+    p.bitCrushHard = param("bitCrushHard");
+    p.bitCrushMix = param("bitCrushMix");
+
+    p.reverbEnable = param("reverbEnable");
+    p.reverbType = param("reverbType");
+    p.reverbDecayTime = param("reverbDecayTime");
+    p.reverbPreDelay = param("reverbPreDelay");
+    p.reverbMix = param("reverbMix");
+
+    p.pitchShifterEnable = param("pitchShifterEnable");
+    p.pitchShifterSemitones = param("pitchShifterSemitones");
+    p.pitchShifterMix = param("pitchShifterMix");
+    p.pitchShifterQuality = param("pitchShifterQuality");
+    return p;
+}
+
 double DemoFxChain::getBpmOrDefault(juce::AudioPlayHead* playHead, double fallback)
 {
     if (playHead == nullptr)
@@ -64,9 +168,10 @@ void DemoFxChain::prepare(double sr, int maxSamples, int ch)
     numChannels = ch;
 
     dry.setSize(numChannels, maxBlockSize);
+    scratchArena.prepare(numChannels, maxBlockSize);
 
     amountSmoothed.reset(sampleRate, 0.05);
-    amountSmoothed.setCurrentAndTargetValue(apvts.getRawParameterValue("amount")->load());
+    amountSmoothed.setCurrentAndTargetValue(params.amount.load(1.0f));
 
     preEq.prepare(sampleRate, numChannels, maxBlockSize);
     postEq.prepare(sampleRate, numChannels, maxBlockSize);
@@ -81,6 +186,24 @@ void DemoFxChain::prepare(double sr, int maxSamples, int ch)
     bitcrush.prepare(sampleRate, maxBlockSize, numChannels);
     reverb.prepare(sampleRate, maxBlockSize, numChannels);
     pitch.prepare(sampleRate, maxBlockSize, numChannels);
+
+    dryAlign.setMaximumDelayInSamples(juce::jmax(1, pitch.engine.getMaxLatencySamples()
+                                                     + preComp.engine.getMaxLatencySamples()
+                                                     + postComp.engine.getMaxLatencySamples()));
+    dryAlign.prepare({ sampleRate, (juce::uint32) maxBlockSize, (juce::uint32) numChannels });
+
+    // Latencies depend on the sample rate; always report again after preparing
+    reportedLatency = -1;
+}
+
+void DemoFxChain::reportLatency(juce::AudioProcessor& owner)
+{
+    const int latency = getLatencySamples();
+    if (latency == reportedLatency)
+        return;
+
+    reportedLatency = latency;
+    owner.setLatencySamples(latency);
 }
 
 void DemoFxChain::reset()
@@ -98,16 +221,30 @@ void DemoFxChain::reset()
     bitcrush.reset();
     reverb.reset();
     pitch.reset();
+    dryAlign.reset();
 }
 
 void DemoFxChain::process(juce::AudioBuffer<float>& buffer, juce::AudioPlayHead* playHead)
 {
+    // Hosts may exceed the block size given to prepare(); run such blocks in prepared-size pieces
+    // so the dry buffer and the scratch arena always cover them
+    if (buffer.getNumSamples() > maxBlockSize && maxBlockSize > 0)
+    {
+        for (int start = 0; start < buffer.getNumSamples(); start += maxBlockSize)
+        {
+            juce::AudioBuffer<float> chunk(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), start,
+                                           juce::jmin(maxBlockSize, buffer.getNumSamples() - start));
+            process(chunk, playHead);
+        }
+        return;
+    }
+
     lastBpm = getBpmOrDefault(playHead, lastBpm);
 
     dry.makeCopyOf(buffer, true);
 
     // Global macro: Amount is the public knob and should fade the whole effect in/out.
-    const float amountTarget = apvts.getRawParameterValue("amount")->load();
+    const float amountTarget = params.amount.load(1.0f);
     amountSmoothed.setTargetValue(amountTarget);
     const float amountStart = amountSmoothed.getNextValue();
     if (buffer.getNumSamples() > 1)
@@ -115,125 +252,100 @@ void DemoFxChain::process(juce::AudioBuffer<float>& buffer, juce::AudioPlayHead*
     const float amountEnd = amountSmoothed.getCurrentValue();
     const float amount = juce::jlimit(0.0f, 1.0f, 0.5f * (amountStart + amountEnd));
 
-    const float inDb = apvts.getRawParameterValue("inGain")->load();
-    const float outDb = apvts.getRawParameterValue("outGain")->load();
-    const float inG = dbToLin(inDb);
-    const float outG = dbToLin(outDb);
+    const float inG = dbToLin(params.inGain.load(0.0f));
+    const float outG = dbToLin(params.outGain.load(0.0f));
     buffer.applyGain(inG);
 
     // ---- update parameter blocks ----
-    preEq.setEnabled(apvts.getRawParameterValue("preEQEnable")->load() > 0.5f);
-    preEq.setCuts(apvts.getRawParameterValue("preEQLowCut")->load(),
-                  apvts.getRawParameterValue("preEQHighCut")->load());
-    for (int b = 1; b <= 4; ++b)
+    const auto updateEq = [](Eq4& eq, const EqParams& p)
     {
-        const auto s = juce::String(b);
-        preEq.setBand(b - 1,
-                      apvts.getRawParameterValue("preEQFrequency" + s)->load(),
-                      apvts.getRawParameterValue("preEQGain" + s)->load(),
-                      apvts.getRawParameterValue("preEQQuality" + s)->load());
-    }
+        eq.setEnabled(p.enable.loadBool(false));
+        eq.setCuts(p.lowCut.load(20.0f), p.highCut.load(20000.0f));
+        for (int b = 0; b < 4; ++b)
+            eq.setBand(b, p.frequency[(size_t) b].load(1000.0f), p.gain[(size_t) b].load(0.0f),
+                       p.quality[(size_t) b].load(0.707f));
+    };
 
-    postEq.setEnabled(apvts.getRawParameterValue("postEQEnable")->load() > 0.5f);
-    postEq.setCuts(apvts.getRawParameterValue("postEQLowCut")->load(),
-                   apvts.getRawParameterValue("postEQHighCut")->load());
-    for (int b = 1; b <= 4; ++b)
+    const auto updateComp = [](Comp& comp, const CompParams& p)
     {
-        const auto s = juce::String(b);
-        postEq.setBand(b - 1,
-                       apvts.getRawParameterValue("postEQFrequency" + s)->load(),
-                       apvts.getRawParameterValue("postEQGain" + s)->load(),
-                       apvts.getRawParameterValue("postEQQuality" + s)->load());
-    }
+        comp.setEnabled(p.enable.loadBool(false));
+        comp.setParams(p.threshold.load(0.0f), p.ratio.load(1.0f), p.attack.load(10.0f), p.release.load(100.0f));
+        comp.setInOutGain(p.inGain.load(0.0f), p.outGain.load(0.0f));
+        comp.setLookahead(p.lookahead.load(0.0f));
+    };
 
-    preComp.setEnabled(apvts.getRawParameterValue("preCompressorEnable")->load() > 0.5f);
-    preComp.setParams(apvts.getRawParameterValue("preCompressorThreshold")->load(),
-                      apvts.getRawParameterValue("preCompressorRatio")->load(),
-                      apvts.getRawParameterValue("preCompressorAttack")->load(),
-                      apvts.getRawParameterValue("preCompressorRelease")->load());
-    preComp.setInOutGain(apvts.getRawParameterValue("preCompressorInGain")->load(),
-                         apvts.getRawParameterValue("preCompressorOutGain")->load());
-
-    postComp.setEnabled(apvts.getRawParameterValue("postCompressorEnable")->load() > 0.5f);
-    postComp.setParams(apvts.getRawParameterValue("postCompressorThreshold")->load(),
-                       apvts.getRawParameterValue("postCompressorRatio")->load(),
-                       apvts.getRawParameterValue("postCompressorAttack")->load(),
-                       apvts.getRawParameterValue("postCompressorRelease")->load());
-    postComp.setInOutGain(apvts.getRawParameterValue("postCompressorInGain")->load(),
-                          apvts.getRawParameterValue("postCompressorOutGain")->load());
-
-    deesser.setEnabled(apvts.getRawParameterValue("deesserEnable")->load() > 0.5f);
-    deesser.setParams(apvts.getRawParameterValue("deesserFrequency")->load(),
-                      apvts.getRawParameterValue("deesserThreshold")->load());
-
-    delay1.setEnabled(apvts.getRawParameterValue("delayEnable1")->load() > 0.5f);
-    delay1.setParams((int) apvts.getRawParameterValue("delayType1")->load(),
-                     apvts.getRawParameterValue("delaySync1")->load() > 0.5f,
-                     (int) apvts.getRawParameterValue("delayRhythm1")->load(),
-                     apvts.getRawParameterValue("delayTime1")->load(),
-                     apvts.getRawParameterValue("delayFeedback1")->load(),
-                     apvts.getRawParameterValue("delayMix1")->load() * amount,
-                     apvts.getRawParameterValue("delayHP1")->load(),
-                     apvts.getRawParameterValue("delayLP1")->load(),
-                     apvts.getRawParameterValue("delayLfoRate1")->load(),
-                     apvts.getRawParameterValue("delayLfoDepth1")->load());
-
-    delay2.setEnabled(apvts.getRawParameterValue("delayEnable2")->load() > 0.5f);
-    delay2.setParams((int) apvts.getRawParameterValue("delayType2")->load(),
-                     apvts.getRawParameterValue("delaySync2")->load() > 0.5f,
-                     (int) apvts.getRawParameterValue("delayRhythm2")->load(),
-                     apvts.getRawParameterValue("delayTime2")->load(),
-                     apvts.getRawParameterValue("delayFeedback2")->load(),
-                     apvts.getRawParameterValue("delayMix2")->load() * amount,
-                     apvts.getRawParameterValue("delayHP2")->load(),
-                     apvts.getRawParameterValue("delayLP2")->load(),
-                     apvts.getRawParameterValue("delayLfoRate2")->load(),
-                     apvts.getRawParameterValue("delayLfoDepth2")->load());
-
-    distortion.setEnabled(apvts.getRawParameterValue("distortionEnable")->load() > 0.5f);
-    distortion.setParams(apvts.getRawParameterValue("distortionDrive1")->load(),
-                         apvts.getRawParameterValue("distortionDrive2")->load(),
-                         apvts.getRawParameterValue("distortionMix1")->load() * amount,
-                         apvts.getRawParameterValue("distortionMix2")->load() * amount);
-
-    phaser.setEnabled(apvts.getRawParameterValue("phaserEnable")->load() > 0.5f);
-    phaser.setParams(apvts.getRawParameterValue("phaserFrequency")->load(),
-                     apvts.getRawParameterValue("phaserIntensity")->load(),
-                     apvts.getRawParameterValue("phaserDepth")->load(),
-                     apvts.getRawParameterValue("phaserMix")->load() * amount);
-
-    flanger.setEnabled(apvts.getRawParameterValue("flangerEnable")->load() > 0.5f);
-    flanger.setParams(apvts.getRawParameterValue("flangerFrequency")->load(),
-                      apvts.getRawParameterValue("flangerIntensity")->load(),
-                      apvts.getRawParameterValue("flangerFeedback")->load(),
-                      apvts.getRawParameterValue("flangerMix")->load() * amount);
-
-    bitcrush.setParams(apvts.getRawParameterValue("bitCrushDepth")->load(),
-                       apvts.getRawParameterValue("bitCrushFrequency")->load(),
-                       apvts.getRawParameterValue("bitCrushHard")->load(),
-                       apvts.getRawParameterValue("bitCrushMix")->load() * amount);
-
-    reverb.setEnabled(apvts.getRawParameterValue("reverbEnable")->load() > 0.5f);
-    reverb.setParams((int) apvts.getRawParameterValue("reverbType")->load(),
-                     apvts.getRawParameterValue("reverbDecayTime")->load(),
-                     apvts.getRawParameterValue("reverbPreDelay")->load(),
-                     apvts.getRawParameterValue("reverbMix")->load() * amount);
-
-    pitch.setEnabled(apvts.getRawParameterValue("pitchShifterEnable")->load() > 0.5f);
-    pitch.setParams(apvts.getRawParameterValue("pitchShifterSemitones")->load(),
-                    apvts.getRawParameterValue("pitchShifterMix")->load() * amount);
+    const auto updateDelay = [amount](Delay& delay, const DelayParams& p)
+    {
+        delay.setEnabled(p.enable.loadBool(false));
+        delay.setParams(p.type.loadInt(0), p.sync.loadBool(false), p.rhythm.loadInt(2), p.time.load(250.0f),
+                        p.feedback.load(0.0f), p.mix.load(0.0f) * amount, p.hp.load(20.0f), p.lp.load(20000.0f),
+                        p.lfoRate.load(0.0f), p.lfoDepth.load(0.0f));
+    };
+
+    updateEq(preEq, params.preEq);
+    updateEq(postEq, params.postEq);
+    updateComp(preComp, params.preComp);
+    updateComp(postComp, params.postComp);
+
+    deesser.setEnabled(params.deesserEnable.loadBool(false));
+    deesser.setParams(params.deesserFrequency.load(6000.0f), params.deesserThreshold.load(0.0f));
+
+    updateDelay(delay1, params.delays[0]);
+    updateDelay(delay2, params.delays[1]);
+
+    distortion.setEnabled(params.distortionEnable.loadBool(false));
+    distortion.setParams(params.distortionDrive1.load(0.0f),
+                         params.distortionDrive2.load(0.0f),
+                         params.distortionMix1.load(0.0f) * amount,
+                         params.distortionMix2.load(0.0f) * amount);
+
+    phaser.setEnabled(params.phaserEnable.loadBool(false));
+    phaser.setParams(params.phaserFrequency.load(0.2f),
+                     params.phaserIntensity.load(0.0f),
+                     params.phaserDepth.load(0.25f),
+                     params.phaserMix.load(0.0f) * amount);
+
+    flanger.setEnabled(params.flangerEnable.loadBool(false));
+    flanger.setParams(params.flangerFrequency.load(0.25f),
+                      params.flangerIntensity.load(0.0f),
+                      params.flangerFeedback.load(0.0f),
+                      params.flangerMix.load(0.0f) * amount);
+
+    bitcrush.setParams(params.bitCrushDepth.load(0.0f),
+                       params.bitCrushFrequency.load(1.0f),
+                       params.bitCrushHard.load(0.0f),
+                       params.bitCrushMix.load(0.0f) * amount);
+
+    reverb.setEnabled(params.reverbEnable.loadBool(false));
+    reverb.setParams(params.reverbType.loadInt(0),
+                     params.reverbDecayTime.load(0.5f),
+                     params.reverbPreDelay.load(0.0f),
+                     params.reverbMix.load(0.0f) * amount);
+
+    pitch.setEnabled(params.pitchShifterEnable.loadBool(false));
+    pitch.setParams(params.pitchShifterSemitones.load(0.0f),
+                    params.pitchShifterMix.load(0.0f) * amount,
+                    params.pitchShifterQuality.loadInt((int) PitchShiftEngine::Mode::balanced));
+
+    // The global dry path must carry the same delay as the processed path
+    {
+        dryAlign.setDelay((float) getLatencySamples());
+        auto dryBlock = juce::dsp::AudioBlock<float>(dry).getSubBlock(0, (size_t) buffer.getNumSamples());
+        juce::dsp::ProcessContextReplacing<float> dryCtx(dryBlock);
+        dryAlign.process(dryCtx);
+    }
 
     // ---- process chain ----
     preEq.process(buffer);
     preComp.process(buffer);
     pitch.process(buffer);
-    delay1.process(buffer, lastBpm);
-    delay2.process(buffer, lastBpm);
+    delay1.process(buffer, lastBpm, scratchArena);
+    delay2.process(buffer, lastBpm, scratchArena);
     distortion.process(buffer);
-    phaser.process(buffer);
-    flanger.process(buffer);
-    bitcrush.process(buffer);
-    reverb.process(buffer);
+    phaser.process(buffer, scratchArena);
+    flanger.process(buffer, scratchArena);
+    bitcrush.process(buffer, scratchArena);
+    reverb.process(buffer, scratchArena);
     postEq.process(buffer);
     deesser.process(buffer);
     postComp.process(buffer);
@@ -250,20 +362,19 @@ void DemoFxChain::Eq4::prepare(double sr, int ch, int)
 {
     sampleRate = sr;
     numChannels = ch;
-    for (auto& f : filtersL) f.reset();
-    for (auto& f : filtersR) f.reset();
-    coeffs.fill(juce::dsp::IIR::Coefficients<float>::makeAllPass(sampleRate, 1000.0));
-    for (int i = 0; i < (int) coeffs.size(); ++i)
+
+    // Start flat; the next setCuts()/setBand() designs every section for the new rate
+    for (int i = 0; i < (int) designed.size(); ++i)
     {
-        filtersL[(size_t) i].coefficients = coeffs[(size_t) i];
-        filtersR[(size_t) i].coefficients = coeffs[(size_t) i];
+        cascade.setIdentity(i);
+        designed[(size_t) i] = {};
     }
+    cascade.reset();
 }
 
 void DemoFxChain::Eq4::reset()
 {
-    for (auto& f : filtersL) f.reset();
-    for (auto& f : filtersR) f.reset();
+    cascade.reset();
 }
 
 void DemoFxChain::Eq4::setCuts(float lowCutHz, float highCutHz)
@@ -271,13 +382,17 @@ void DemoFxChain::Eq4::setCuts(float lowCutHz, float highCutHz)
     lowCutHz = clampSafe(lowCutHz, 20.0f, 20000.0f);
     highCutHz = clampSafe(highCutHz, 20.0f, 20000.0f);
 
-    coeffs[0] = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, lowCutHz);
-    coeffs[1] = juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, highCutHz);
+    if (! designed[0].matches(lowCutHz, 0.0f, 0.0f))
+    {
+        cascade.setSection(0, juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(sampleRate, lowCutHz));
+        designed[0] = { lowCutHz, 0.0f, 0.0f };
+    }
 
-    filtersL[0].coefficients = coeffs[0];
-    filtersR[0].coefficients = coeffs[0];
-    filtersL[1].coefficients = coeffs[1];
-    filtersR[1].coefficients = coeffs[1];
+    if (! designed[1].matches(highCutHz, 0.0f, 0.0f))
+    {
+        cascade.setSection(1, juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, highCutHz));
+        designed[1] = { highCutHz, 0.0f, 0.0f };
+    }
 }
 
 void DemoFxChain::Eq4::setBand(int bandIndex0, float freqHz, float gainDb, float q)
@@ -287,61 +402,55 @@ void DemoFxChain::Eq4::setBand(int bandIndex0, float freqHz, float gainDb, float
 
     freqHz = clampSafe(freqHz, 20.0f, 20000.0f);
     q = clampSafe(q, 0.2f, 10.0f);
+    gainDb = clampSafe(gainDb, -48.0f, 48.0f);
 
-    const float gain = juce::Decibels::decibelsToGain(gainDb);
-    coeffs[(size_t) (2 + bandIndex0)] = juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate, freqHz, q, gain);
+    const int section = 2 + bandIndex0;
+    if (designed[(size_t) section].matches(freqHz, gainDb, q))
+        return;
 
-    filtersL[(size_t) (2 + bandIndex0)].coefficients = coeffs[(size_t) (2 + bandIndex0)];
-    filtersR[(size_t) (2 + bandIndex0)].coefficients = coeffs[(size_t) (2 + bandIndex0)];
+    const float gain = juce::Decibels::decibelsToGain(gainDb);
+    cascade.setSection(section, juce::dsp::IIR::ArrayCoefficients<float>::makePeakFilter(sampleRate, freqHz, q, gain));
+    designed[(size_t) section] = { freqHz, gainDb, q };
 }
 
 void DemoFxChain::Eq4::process(juce::AudioBuffer<float>& buffer)
 {
-    if (!enabled)
+    if (!enabled || buffer.getNumChannels() == 0)
         return;
 
-    auto block = juce::dsp::AudioBlock<float>(buffer);
-    auto left = block.getSingleChannelBlock(0);
-    juce::dsp::ProcessContextReplacing<float> ctxL(left);
-
-    for (int i = 0; i < 6; ++i)
-        filtersL[(size_t) i].process(ctxL);
-
-    if (buffer.getNumChannels() > 1)
-    {
-        auto right = block.getSingleChannelBlock(1);
-        juce::dsp::ProcessContextReplacing<float> ctxR(right);
-        for (int i = 0; i < 6; ++i)
-            filtersR[(size_t) i].process(ctxR);
-    }
+    cascade.process(buffer.getWritePointer(0),
+                    buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : nullptr,
+                    buffer.getNumSamples());
 }
 
 // ===================== Comp =====================
 
-void DemoFxChain::Comp::prepare(double sr, int, int ch)
+void DemoFxChain::Comp::prepare(double sr, int maxSamples, int ch)
 {
-    juce::dsp::ProcessSpec spec { sr, 2048u, (juce::uint32) ch };
-    comp.prepare(spec);
-    comp.reset();
+    engine.prepare(sr, maxSamples, ch);
 }
 
 void DemoFxChain::Comp::reset()
 {
-    comp.reset();
+    engine.reset();
 }
 
 void DemoFxChain::Comp::setParams(float thresholdDb, float ratio, float attackMs, float releaseMs)
 {
-    comp.setThreshold(thresholdDb);
-    comp.setRatio(clampSafe(ratio, 1.0f, 20.0f));
-    comp.setAttack(clampSafe(attackMs, 0.1f, 200.0f));
-    comp.setRelease(clampSafe(releaseMs, 10.0f, 2000.0f));
+    engine.setParameters(clampSafe(thresholdDb, -80.0f, 0.0f),
+                         clampSafe(ratio, 1.0f, 20.0f),
+                         clampSafe(attackMs, 0.1f, 200.0f),
+                         clampSafe(releaseMs, 10.0f, 2000.0f));
 }
 
 void DemoFxChain::Comp::setInOutGain(float inDb, float outDb)
 {
-    inGain = juce::Decibels::decibelsToGain(inDb);
-    outGain = juce::Decibels::decibelsToGain(outDb);
+    engine.setInOutGain(clampSafe(inDb, -48.0f, 48.0f), clampSafe(outDb, -48.0f, 48.0f));
+}
+
+void DemoFxChain::Comp::setLookahead(float ms)
+{
+    engine.setLookahead(clampSafe(ms, 0.0f, CompressorEngine::kMaxLookaheadMs));
 }
 
 void DemoFxChain::Comp::process(juce::AudioBuffer<float>& buffer)
@@ -349,78 +458,97 @@ void DemoFxChain::Comp::process(juce::AudioBuffer<float>& buffer)
     if (!enabled)
         return;
 
-    buffer.applyGain(inGain);
-    auto block = juce::dsp::AudioBlock<float>(buffer);
-    juce::dsp::ProcessContextReplacing<float> ctx(block);
-    comp.process(ctx);
-    buffer.applyGain(outGain);
+    engine.process(buffer);
 }
 
 // ===================== DeEsser =====================
 
-void DemoFxChain::DeEsser::prepare(double sr, int, int ch)
+void DemoFxChain::DeEsser::prepare(double sr, int, int)
 {
     sampleRate = sr;
-    juce::dsp::ProcessSpec spec { sr, 2048u, (juce::uint32) ch };
-    comp.prepare(spec);
-    reset();
+    attackCoef = std::exp(-1.0f / (kAttackMs * 0.001f * (float) sampleRate));
+    releaseCoef = std::exp(-1.0f / (kReleaseMs * 0.001f * (float) sampleRate));
+
+    freqHz = -1.0f; // force a redesign at the new rate
     setParams(6000.0f, -24.0f);
+    reset();
 }
 
 void DemoFxChain::DeEsser::reset()
 {
-    hpL.reset();
-    hpR.reset();
-    comp.reset();
+    ic1 = {};
+    ic2 = {};
+    envelope = 0.0f;
+    bandGain = 1.0f;
 }
 
-void DemoFxChain::DeEsser::setParams(float freqHz, float thresholdDb)
+void DemoFxChain::DeEsser::setParams(float f, float thresholdDbIn)
 {
-    freqHz = clampSafe(freqHz, 1000.0f, 12000.0f);
-    hpCoef = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, freqHz);
-    hpL.coefficients = hpCoef;
-    hpR.coefficients = hpCoef;
+    f = clampSafe(f, 1000.0f, 12000.0f);
+    f = juce::jmin(f, (float) sampleRate * 0.45f);
+    thresholdDb = clampSafe(thresholdDbIn, -80.0f, 0.0f);
+
+    if (f == freqHz)
+        return;
 
-    comp.setThreshold(thresholdDb);
-    comp.setRatio(6.0f);
-    comp.setAttack(2.0f);
-    comp.setRelease(80.0f);
+    freqHz = f;
+    const float g = std::tan(juce::MathConstants<float>::pi * freqHz / (float) sampleRate);
+    svfK = 1.0f / kQ;
+    svfA1 = 1.0f / (1.0f + g * (g + svfK));
+    svfA2 = g * svfA1;
+    svfA3 = g * svfA2;
 }
 
 void DemoFxChain::DeEsser::process(juce::AudioBuffer<float>& buffer)
 {
-    if (!enabled)
+    if (!enabled || buffer.getNumChannels() == 0)
         return;
 
-    juce::AudioBuffer<float> hf;
-    hf.makeCopyOf(buffer, true);
+    const int numSamples = buffer.getNumSamples();
+    const bool stereo = buffer.getNumChannels() > 1;
+    float* left = buffer.getWritePointer(0);
+    float* right = stereo ? buffer.getWritePointer(1) : nullptr;
 
-    auto block = juce::dsp::AudioBlock<float>(hf);
-    auto left = block.getSingleChannelBlock(0);
-    juce::dsp::ProcessContextReplacing<float> ctxL(left);
-    hpL.process(ctxL);
-    if (hf.getNumChannels() > 1)
-    {
-        auto right = block.getSingleChannelBlock(1);
-        juce::dsp::ProcessContextReplacing<float> ctxR(right);
-        hpR.process(ctxR);
-    }
+    const float slope = 1.0f - 1.0f / kRatio;
 
-    // Compress high band
-    juce::dsp::ProcessContextReplacing<float> ctx(block);
-    comp.process(ctx);
+    // Unity-peak band-pass output for one channel
+    const auto bandPass = [this](float x, size_t ch)
+    {
+        const float v3 = x - ic2[ch];
+        const float v1 = svfA1 * ic1[ch] + svfA2 * v3;
+        const float v2 = ic2[ch] + svfA2 * ic1[ch] + svfA3 * v3;
+        ic1[ch] = 2.0f * v1 - ic1[ch];
+        ic2[ch] = 2.0f * v2 - ic2[ch];
+        return svfK * v1;
+    };
 
-    // Subtract compressed HF delta from original to reduce sibilance.
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    for (int start = 0; start < numSamples; start += kGainInterval)
     {
-        auto* dst = buffer.getWritePointer(ch);
-        auto* hfIn = hf.getReadPointer(ch);
-        auto* dryPtr = buffer.getReadPointer(ch);
-        for (int i = 0; i < buffer.getNumSamples(); ++i)
+        const int end = juce::jmin(numSamples, start + kGainInterval);
+
+        // Gain computer at control rate, linearly interpolated across the interval
+        const float envDb = juce::Decibels::gainToDecibels(envelope, -100.0f);
+        const float over = envDb - thresholdDb;
+        const float target = over > 0.0f ? juce::Decibels::decibelsToGain(-over * slope) : 1.0f;
+        const float step = (target - bandGain) / (float) (end - start);
+
+        for (int i = start; i < end; ++i)
         {
-            const float hfDelta = dryPtr[i] - hfIn[i];
-            dst[i] = dst[i] - hfDelta;
+            const float bandL = bandPass(left[i], 0);
+            const float bandR = stereo ? bandPass(right[i], 1) : bandL;
+
+            const float level = juce::jmax(std::abs(bandL), std::abs(bandR));
+            const float coef = level > envelope ? attackCoef : releaseCoef;
+            envelope = level + coef * (envelope - level);
+
+            bandGain += step;
+            const float cut = 1.0f - bandGain;
+            left[i] -= cut * bandL;
+            if (stereo)
+                right[i] -= cut * bandR;
         }
+
+        bandGain = target;
     }
 }
 
@@ -436,6 +564,14 @@ void DemoFxChain::Delay::prepare(double sr, int)
     hpL.reset(); hpR.reset(); lpL.reset(); lpR.reset();
     phase = 0.0f;
     fbStateL = fbStateR = 0.0f;
+
+    // Feedback filters share one coefficient object per type, updated in place in process()
+    hpCoef = new juce::dsp::IIR::Coefficients<float>(
+        juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(sampleRate, hpHz));
+    lpCoef = new juce::dsp::IIR::Coefficients<float>(
+        juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, lpHz));
+    hpL.coefficients = hpCoef; hpR.coefficients = hpCoef;
+    lpL.coefficients = lpCoef; lpR.coefficients = lpCoef;
 }
 
 void DemoFxChain::Delay::reset()
@@ -461,13 +597,13 @@ void DemoFxChain::Delay::setParams(int t, bool s, int r, float tm, float fb, flo
     lfoDepth = clampSafe(ld, 0.0f, 1.0f);
 }
 
-void DemoFxChain::Delay::process(juce::AudioBuffer<float>& buffer, double bpm)
+void DemoFxChain::Delay::process(juce::AudioBuffer<float>& buffer, double bpm, ScratchArena& scratch)
 {
     if (!enabled || mix <= 0.0001f)
         return;
 
-    juce::AudioBuffer<float> localDry;
-    localDry.makeCopyOf(buffer, true);
+    const ScratchArena::Lease dryLease(scratch, buffer);
+    const auto& localDry = dryLease.getBuffer();
 
     const float sr = (float) sampleRate;
     const float secondsPerBeat = 60.0f / (float) (bpm > 0.0 ? bpm : 120.0);
@@ -488,10 +624,8 @@ void DemoFxChain::Delay::process(juce::AudioBuffer<float>& buffer, double bpm)
     dl.setDelay(delaySamples);
     dr.setDelay(delaySamples);
 
-    hpCoef = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, hpHz);
-    lpCoef = juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, lpHz);
-    hpL.coefficients = hpCoef; hpR.coefficients = hpCoef;
-    lpL.coefficients = lpCoef; lpR.coefficients = lpCoef;
+    *hpCoef = juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(sampleRate, hpHz);
+    *lpCoef = juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, lpHz);
 
     for (int i = 0; i < buffer.getNumSamples(); ++i)
     {
@@ -539,7 +673,8 @@ void DemoFxChain::Delay::process(juce::AudioBuffer<float>& buffer, double bpm)
             buffer.setSample(1, i, inR + wetR);
     }
 
-    mixWet(buffer, localDry, mix);
+    if (dryLease.isValid())
+        mixWet(buffer, localDry, mix);
 }
 
 // ===================== Flanger =====================
@@ -565,13 +700,13 @@ void DemoFxChain::Flanger::setParams(float r, float i, float fb, float m)
     mix = clampSafe(m, 0.0f, 1.0f);
 }
 
-void DemoFxChain::Flanger::process(juce::AudioBuffer<float>& buffer)
+void DemoFxChain::Flanger::process(juce::AudioBuffer<float>& buffer, ScratchArena& scratch)
 {
     if (!enabled || mix <= 0.0001f)
         return;
 
-    juce::AudioBuffer<float> localDry;
-    localDry.makeCopyOf(buffer, true);
+    const ScratchArena::Lease dryLease(scratch, buffer);
+    const auto& localDry = dryLease.getBuffer();
 
     const float sr = (float) sampleRate;
     const float phaseInc = (rateHz / sr) * juce::MathConstants<float>::twoPi;
@@ -603,7 +738,8 @@ void DemoFxChain::Flanger::process(juce::AudioBuffer<float>& buffer)
             phase -= juce::MathConstants<float>::twoPi;
     }
 
-    mixWet(buffer, localDry, mix);
+    if (dryLease.isValid())
+        mixWet(buffer, localDry, mix);
 }
 
 // ===================== Phaser =====================
@@ -628,13 +764,13 @@ void DemoFxChain::Phaser::setParams(float r, float i, float d, float m)
     mix = clampSafe(m, 0.0f, 1.0f);
 }
 
-void DemoFxChain::Phaser::process(juce::AudioBuffer<float>& buffer)
+void DemoFxChain::Phaser::process(juce::AudioBuffer<float>& buffer, ScratchArena& scratch)
 {
     if (!enabled || mix <= 0.0001f)
         return;
 
-    juce::AudioBuffer<float> localDry;
-    localDry.makeCopyOf(buffer, true);
+    const ScratchArena::Lease dryLease(scratch, buffer);
+    const auto& localDry = dryLease.getBuffer();
 
     phaser.setRate(rateHz);
     phaser.setDepth(depth);
@@ -645,7 +781,8 @@ void DemoFxChain::Phaser::process(juce::AudioBuffer<float>& buffer)
     juce::dsp::ProcessContextReplacing<float> ctx(block);
     phaser.process(ctx);
 
-    mixWet(buffer, localDry, mix);
+    if (dryLease.isValid())
+        mixWet(buffer, localDry, mix);
 }
 
 // ===================== Distortion =====================
@@ -666,9 +803,6 @@ void DemoFxChain::Distortion::process(juce::AudioBuffer<float>& buffer)
     if (!enabled || (mix1 <= 0.0001f && mix2 <= 0.0001f))
         return;
 
-    juce::AudioBuffer<float> localDry;
-    localDry.makeCopyOf(buffer, true);
-
     const auto stage = [&](float x, float drive)
     {
         const float g = 1.0f + drive * 2.0f;
@@ -678,10 +812,9 @@ void DemoFxChain::Distortion::process(juce::AudioBuffer<float>& buffer)
     for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
     {
         auto* data = buffer.getWritePointer(ch);
-        auto* d = localDry.getReadPointer(ch);
         for (int i = 0; i < buffer.getNumSamples(); ++i)
         {
-            float x = d[i];
+            float x = data[i]; // each sample is read before it is overwritten, so no dry copy is needed
             float y1 = stage(x, drive1);
             float y = x + mix1 * (y1 - x);
             float y2 = stage(y, drive2);
@@ -709,13 +842,13 @@ void DemoFxChain::BitCrush::setParams(float d, float f, float h, float m)
     mix = clampSafe(m, 0.0f, 1.0f);
 }
 
-void DemoFxChain::BitCrush::process(juce::AudioBuffer<float>& buffer)
+void DemoFxChain::BitCrush::process(juce::AudioBuffer<float>& buffer, ScratchArena& scratch)
 {
     if (mix <= 0.0001f)
         return;
 
-    juce::AudioBuffer<float> localDry;
-    localDry.makeCopyOf(buffer, true);
+    const ScratchArena::Lease dryLease(scratch, buffer);
+    const auto& localDry = dryLease.getBuffer();
 
     const float bits = 16.0f - depth * 14.0f; // 16 -> 2
     const float step = 1.0f / std::pow(2.0f, bits);
@@ -743,35 +876,19 @@ void DemoFxChain::BitCrush::process(juce::AudioBuffer<float>& buffer)
             buffer.setSample(1, i, crush(heldR));
     }
 
-    mixWet(buffer, localDry, mix);
+    if (dryLease.isValid())
+        mixWet(buffer, localDry, mix);
 }
 
 // ===================== Reverb =====================
 
-void DemoFxChain::Reverb::prepare(double sr, int maxSamples, int ch)
+void DemoFxChain::Reverb::prepare(double sr, int, int ch)
 {
     sampleRate = sr;
-    juce::dsp::ProcessSpec spec { sr, (juce::uint32) maxSamples, (juce::uint32) ch };
     reverb.reset();
-    convolution.prepare(spec);
+    convolution.prepare(sr, ch, decaySeconds);
     preDelay.reset();
     preDelay.setDelay(0.0f);
-
-    // Generated plate-ish IR.
-    juce::AudioBuffer<float> ir(1, 4096);
-    juce::Random rng(12345);
-    const float plateDecaySeconds = 1.1f;
-    const float decayCoeff = std::exp(-1.0f / ((float) sampleRate * plateDecaySeconds));
-    float env = 1.0f;
-    for (int i = 0; i < ir.getNumSamples(); ++i)
-    {
-        ir.setSample(0, i, (rng.nextFloat() * 2.0f - 1.0f) * env);
-        env *= decayCoeff;
-    }
-    convolution.loadImpulseResponse(std::move(ir), sampleRate,
-                                    juce::dsp::Convolution::Stereo::no,
-                                    juce::dsp::Convolution::Trim::yes,
-                                    juce::dsp::Convolution::Normalise::yes);
 }
 
 void DemoFxChain::Reverb::reset()
@@ -787,15 +904,18 @@ void DemoFxChain::Reverb::setParams(int t, float decay, float preMs, float m)
     decaySeconds = clampSafe(decay, 0.05f, 10.0f);
     predelayMs = clampSafe(preMs, 0.0f, 250.0f);
     mix = clampSafe(m, 0.0f, 1.0f);
+
+    if (type == 1)
+        convolution.setDecay(decaySeconds);
 }
 
-void DemoFxChain::Reverb::process(juce::AudioBuffer<float>& buffer)
+void DemoFxChain::Reverb::process(juce::AudioBuffer<float>& buffer, ScratchArena& scratch)
 {
     if (!enabled || mix <= 0.0001f)
         return;
 
-    juce::AudioBuffer<float> localDry;
-    localDry.makeCopyOf(buffer, true);
+    const ScratchArena::Lease dryLease(scratch, buffer);
+    const auto& localDry = dryLease.getBuffer();
 
     const float preSamples = (predelayMs * 0.001f) * (float) sampleRate;
     preDelay.setDelay(juce::jlimit(0.0f, (float) sampleRate, preSamples));
@@ -826,96 +946,39 @@ void DemoFxChain::Reverb::process(juce::AudioBuffer<float>& buffer)
         reverb.process(ctx);
     else
     {
-        convolution.process(ctx);
+        convolution.process(buffer);
         reverb.process(ctx);
     }
 
-    mixWet(buffer, localDry, mix);
+    if (dryLease.isValid())
+        mixWet(buffer, localDry, mix);
 }
 
 // ===================== PitchShifter =====================
 
-void DemoFxChain::PitchShifter::prepare(double sr, int maxSamples, int ch)
+void DemoFxChain::PitchShifter::prepare(double sr, int, int ch)
 {
-    sampleRate = sr;
-    numChannels = ch;
-    ringSize = (int) std::round(sampleRate * 0.12); // 120ms window
-    ringSize = juce::jlimit(2048, 131072, ringSize);
-    ring.setSize(numChannels, ringSize);
-    ring.clear();
-    writePos = 0;
-    readPosA = 0.0f;
-    readPosB = (float) ringSize * 0.5f;
-    speed = 1.0f;
-    juce::ignoreUnused(maxSamples);
+    engine.prepare(sr, ch);
 }
 
 void DemoFxChain::PitchShifter::reset()
 {
-    ring.clear();
-    writePos = 0;
-    readPosA = 0.0f;
-    readPosB = (float) ringSize * 0.5f;
+    engine.reset();
 }
 
-void DemoFxChain::PitchShifter::setParams(float st, float m)
+void DemoFxChain::PitchShifter::setParams(float st, float m, int quality)
 {
-    semitones = clampSafe(st, -24.0f, 24.0f);
-    mix = clampSafe(m, 0.0f, 1.0f);
-    speed = std::pow(2.0f, semitones / 12.0f);
+    engine.setSemitones(clampSafe(st, -24.0f, 24.0f));
+    engine.setMix(clampSafe(m, 0.0f, 1.0f));
+    engine.setMode((PitchShiftEngine::Mode) juce::jlimit(0, 2, quality));
 }
 
 void DemoFxChain::PitchShifter::process(juce::AudioBuffer<float>& buffer)
 {
-    if (!enabled || mix <= 0.0001f || std::abs(semitones) < 0.001f)
+    // While enabled the engine always runs, even at 0 semitones or no mix, so the stage
+    // latency stays what getLatencySamples() reports.
+    if (!enabled)
         return;
 
-    juce::AudioBuffer<float> localDry;
-    localDry.makeCopyOf(buffer, true);
-
-    const auto readSample = [&](int ch, float pos) -> float
-    {
-        // Linear interpolation
-        int i0 = (int) std::floor(pos);
-        int i1 = (i0 + 1) % ringSize;
-        float frac = pos - (float) i0;
-        auto* r = ring.getReadPointer(ch);
-        return r[i0] + frac * (r[i1] - r[i0]);
-    };
-
-    for (int i = 0; i < buffer.getNumSamples(); ++i)
-    {
-        const float aDist = std::fmod((float) writePos - readPosA + (float) ringSize, (float) ringSize);
-        const float bDist = std::fmod((float) writePos - readPosB + (float) ringSize, (float) ringSize);
-        const float xfadeA = juce::jlimit(0.0f, 1.0f, aDist / ((float) ringSize * 0.5f));
-        const float xfadeB = juce::jlimit(0.0f, 1.0f, bDist / ((float) ringSize * 0.5f));
-
-        const float wA = std::sin(xfadeA * juce::MathConstants<float>::pi);
-        const float wB = std::sin(xfadeB * juce::MathConstants<float>::pi);
-        const float norm = (wA + wB) > 0.0001f ? (1.0f / (wA + wB)) : 1.0f;
-
-        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-        {
-            const float in = buffer.getSample(ch, i);
-            ring.setSample(ch, writePos, in);
-            const float yA = readSample(ch, readPosA);
-            const float yB = readSample(ch, readPosB);
-            const float y = (wA * yA + wB * yB) * norm;
-            buffer.setSample(ch, i, y);
-        }
-
-        writePos = (writePos + 1) % ringSize;
-        readPosA += speed;
-        readPosB += speed;
-        if (readPosA >= (float) ringSize) readPosA -= (float) ringSize;
-        if (readPosB >= (float) ringSize) readPosB -= (float) ringSize;
-
-        // Keep read heads away from write head by wrapping when too close.
-        if (std::abs((float) writePos - readPosA) < 32.0f)
-            readPosA = std::fmod(readPosA + (float) ringSize * 0.5f, (float) ringSize);
-        if (std::abs((float) writePos - readPosB) < 32.0f)
-            readPosB = std::fmod(readPosB + (float) ringSize * 0.5f, (float) ringSize);
-    }
-
-    mixWet(buffer, localDry, mix);
+    engine.process(buffer);
 }
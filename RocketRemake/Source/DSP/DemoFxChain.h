@@ -1,6 +1,12 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "CompressorEngine.h"
+#include "FxModule.h"
+#include "PartitionedConvolver.h"
+#include "PitchShiftEngine.h"
+#include "ScratchArena.h"
+#include "StereoBiquadCascade.h"
 
 class DemoFxChain
 {
@@ -13,19 +19,71 @@ public:
     void process(juce::AudioBuffer<float>& buffer,
                  juce::AudioPlayHead* playHead);
 
+    // Delay the chain currently adds (pitch shifter and compressor lookahead, while enabled).
+    int getLatencySamples() const noexcept
+    {
+        return (pitch.enabled ? pitch.engine.getLatencySamples() : 0)
+             + preComp.getLatencySamples() + postComp.getLatencySamples();
+    }
+
+    // Passes getLatencySamples() to owner.setLatencySamples() when it differs from the last value
+    // reported. The owner calls this at the end of prepareToPlay() and after every process(), which
+    // is where the pitch mode and the enable switches take effect.
+    void reportLatency(juce::AudioProcessor& owner);
+
 private:
     juce::AudioProcessorValueTreeState& apvts;
 
     double sampleRate = 44100.0;
     int maxBlockSize = 512;
     int numChannels = 2;
+    int reportedLatency = -1;
 
     juce::AudioBuffer<float> dry;
+    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::None> dryAlign; // keeps dry in step with getLatencySamples()
+    ScratchArena scratchArena; // per-stage dry copies, sized in prepare()
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> amountSmoothed;
 
     // ---------- Helpers ----------
     static float dbToLin(float db) { return juce::Decibels::decibelsToGain(db); }
 
+    // ---------- Parameter handles ----------
+    // Resolved once in the constructor so process() is only atomic loads; a parameter the
+    // layout lacks stays null and its stage falls back to a neutral value.
+    struct EqParams
+    {
+        FxParam enable, lowCut, highCut;
+        std::array<FxParam, 4> frequency, gain, quality;
+    };
+
+    struct CompParams
+    {
+        FxParam enable, threshold, ratio, attack, release, inGain, outGain, lookahead;
+    };
+
+    struct DelayParams
+    {
+        FxParam enable, type, sync, rhythm, time, feedback, mix, hp, lp, lfoRate, lfoDepth;
+    };
+
+    struct ParamHandles
+    {
+        FxParam amount, inGain, outGain;
+        EqParams preEq, postEq;
+        CompParams preComp, postComp;
+        FxParam deesserEnable, deesserFrequency, deesserThreshold;
+        std::array<DelayParams, 2> delays;
+        FxParam distortionEnable, distortionDrive1, distortionDrive2, distortionMix1, distortionMix2;
+        FxParam phaserEnable, phaserFrequency, phaserIntensity, phaserDepth, phaserMix;
+        FxParam flangerEnable, flangerFrequency, flangerIntensity, flangerFeedback, flangerMix;
+        FxParam bitCrushDepth, bitCrushFrequency, bitCrushHard, bitCrushMix;
+        FxParam reverbEnable, reverbType, reverbDecayTime, reverbPreDelay, reverbMix;
+        FxParam pitchShifterEnable, pitchShifterSemitones, pitchShifterMix, pitchShifterQuality;
+    };
+
+    const ParamHandles params;
+    static ParamHandles makeParamHandles(juce::AudioProcessorValueTreeState& state);
+
     // ---------- Filters / EQ ----------
     struct Eq4
     {
@@ -41,9 +99,20 @@ private:
         double sampleRate = 44100.0;
         int numChannels = 2;
 
-        std::array<juce::dsp::IIR::Filter<float>, 6> filtersL;
-        std::array<juce::dsp::IIR::Filter<float>, 6> filtersR;
-        std::array<juce::dsp::IIR::Coefficients<float>::Ptr, 6> coeffs;
+        // Sections: 0 low cut, 1 high cut, 2..5 peaking bands
+        StereoBiquadCascade<6> cascade;
+
+        // What each section was last designed for; a section is redesigned only when these change
+        struct SectionParams
+        {
+            float freqHz = -1.0f;
+            float gainDb = 0.0f;
+            float q = 0.0f;
+
+            bool matches(float f, float g, float qIn) const noexcept { return f == freqHz && g == gainDb && qIn == q; }
+        };
+
+        std::array<SectionParams, 6> designed;
     };
 
     Eq4 preEq;
@@ -56,20 +125,23 @@ private:
         void reset();
         void process(juce::AudioBuffer<float>& buffer);
 
-        void setEnabled(bool e) { enabled = e; }
+        void setEnabled(bool e) { if (e && !enabled) engine.reset(); enabled = e; }
         void setParams(float thresholdDb, float ratio, float attackMs, float releaseMs);
         void setInOutGain(float inDb, float outDb);
+        void setLookahead(float ms);
+
+        int getLatencySamples() const noexcept { return enabled ? engine.getLatencySamples() : 0; }
 
         bool enabled = false;
-        juce::dsp::Compressor<float> comp;
-        float inGain = 1.0f;
-        float outGain = 1.0f;
+        CompressorEngine engine;
     };
 
     Comp preComp;
     Comp postComp;
 
-    // ---------- De-esser (simple HF compressor) ----------
+    // ---------- De-esser (split-band, streaming) ----------
+    // An SVF band-pass isolates the sibilance band; a stereo-linked envelope of that band
+    // drives how much of it is subtracted from the signal. One pass over the buffer, no copies.
     struct DeEsser
     {
         void prepare(double sr, int maxSamples, int ch);
@@ -79,12 +151,25 @@ private:
         void setEnabled(bool e) { enabled = e; }
         void setParams(float freqHz, float thresholdDb);
 
+        static constexpr float kQ = 0.8f;
+        static constexpr float kRatio = 6.0f;
+        static constexpr float kAttackMs = 2.0f;
+        static constexpr float kReleaseMs = 80.0f;
+        static constexpr int kGainInterval = 8; // samples between gain-computer updates
+
         bool enabled = false;
         double sampleRate = 44100.0;
 
-        juce::dsp::IIR::Filter<float> hpL, hpR;
-        juce::dsp::IIR::Coefficients<float>::Ptr hpCoef;
-        juce::dsp::Compressor<float> comp;
+        // TPT state-variable band-pass (Zavalishin), coefficients for freqHz
+        float freqHz = -1.0f;
+        float svfA1 = 0.0f, svfA2 = 0.0f, svfA3 = 0.0f, svfK = 0.0f;
+        std::array<float, 2> ic1 {}, ic2 {};
+
+        float thresholdDb = 0.0f;
+        float attackCoef = 0.0f;
+        float releaseCoef = 0.0f;
+        float envelope = 0.0f;   // linked peak envelope of the band
+        float bandGain = 1.0f;   // gain applied to the band, 1 = untouched
     };
 
     DeEsser deesser;
@@ -95,7 +180,8 @@ private:
         void prepare(double sr, int maxSamples);
         void reset();
         void process(juce::AudioBuffer<float>& buffer,
-                     double bpm);
+                     double bpm,
+                     ScratchArena& scratch);
 
         void setEnabled(bool e) { enabled = e; }
         void setParams(int type, bool sync, int rhythm, float timeMs, float feedback, float mix,
@@ -133,7 +219,7 @@ private:
     {
         void prepare(double sr, int maxSamples);
         void reset();
-        void process(juce::AudioBuffer<float>& buffer);
+        void process(juce::AudioBuffer<float>& buffer, ScratchArena& scratch);
 
         void setEnabled(bool e) { enabled = e; }
         void setParams(float rateHz, float intensity, float feedback, float mix);
@@ -153,7 +239,7 @@ private:
     {
         void prepare(double sr, int maxSamples, int ch);
         void reset();
-        void process(juce::AudioBuffer<float>& buffer);
+        void process(juce::AudioBuffer<float>& buffer, ScratchArena& scratch);
 
         void setEnabled(bool e) { enabled = e; }
         void setParams(float rateHz, float intensity, float depth, float mix);
@@ -193,7 +279,7 @@ private:
     {
         void prepare(double sr, int maxSamples, int ch);
         void reset();
-        void process(juce::AudioBuffer<float>& buffer);
+        void process(juce::AudioBuffer<float>& buffer, ScratchArena& scratch);
 
         void setParams(float depth, float freq, float hard, float mix);
 
@@ -214,7 +300,7 @@ private:
     {
         void prepare(double sr, int maxSamples, int ch);
         void reset();
-        void process(juce::AudioBuffer<float>& buffer);
+        void process(juce::AudioBuffer<float>& buffer, ScratchArena& scratch);
 
         void setEnabled(bool e) { enabled = e; }
         void setParams(int type, float decaySeconds, float predelayMs, float mix);
@@ -224,7 +310,7 @@ private:
 
         juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> preDelay { 48000 };
         juce::dsp::Reverb reverb;
-        juce::dsp::Convolution convolution;
+        PartitionedConvolver convolution; // type 1; IR rebuilt off the audio thread when the decay changes
 
         int type = 0;
         float decaySeconds = 0.5f;
@@ -234,30 +320,19 @@ private:
 
     Reverb reverb;
 
-    // ---------- Pitch shifter (simple dual-delay shifter) ----------
+    // ---------- Pitch shifter ----------
     struct PitchShifter
     {
         void prepare(double sr, int maxSamples, int ch);
         void reset();
         void process(juce::AudioBuffer<float>& buffer);
 
-        void setEnabled(bool e) { enabled = e; }
-        void setParams(float semitones, float mix);
+        // Re-enabling clears the engine so stale history is not heard
+        void setEnabled(bool e) { if (e && !enabled) engine.reset(); enabled = e; }
+        void setParams(float semitones, float mix, int quality);
 
         bool enabled = false;
-        double sampleRate = 44100.0;
-        int numChannels = 2;
-
-        juce::AudioBuffer<float> ring;
-        int writePos = 0;
-        int ringSize = 0;
-
-        float semitones = 0.0f;
-        float mix = 0.0f;
-        float readPosA = 0.0f;
-        float readPosB = 0.0f;
-
-        float speed = 1.0f;
+        PitchShiftEngine engine;
     };
 
     PitchShifter pitch;
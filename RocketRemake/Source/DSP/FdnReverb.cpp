@@ -0,0 +1,310 @@
+#include "FdnReverb.h"
+
+namespace
+{
+    constexpr int N = FdnReverb::kNumLines;
+
+    // Input polarity per line and the two orthogonal output tap sets
+    constexpr std::array<float, N> kInputSign { 1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f };
+    constexpr std::array<float, N> kLeftTap   { 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f };
+    constexpr std::array<float, N> kRightTap  { 1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f };
+
+    constexpr float kInputGain = 0.35f;
+    constexpr float kOutputGain = 0.5f;
+
+    // Phase in [0, 1) -> sine-shaped value in [-1, 1]
+    inline float parabolicSine(float phase) noexcept
+    {
+        const float x = 2.0f * phase - 1.0f;
+        return 4.0f * x * (1.0f - std::abs(x));
+    }
+}
+
+const FdnReverb::Preset& FdnReverb::getPreset(Algorithm a) noexcept
+{
+    // Line lengths in ms, roughly geometric and mutually detuned; diffusers are short Schroeder allpasses
+    static const Preset hall    { { 43.1f, 51.7f, 59.3f, 67.9f, 73.1f, 81.7f, 89.3f, 97.9f }, { 4.7f, 3.6f, 12.7f, 9.3f },
+                                  0.70f, 1.2f, 9.0f, 1500.0f, 0.35f, 0.40f, 1.0f };
+    static const Preset plate   { { 17.3f, 21.7f, 26.9f, 31.3f, 37.1f, 41.9f, 47.3f, 53.9f }, { 1.3f, 2.1f, 5.9f, 4.3f },
+                                  0.75f, 0.8f, 6.0f, 3000.0f, 0.20f, 0.90f, 1.0f };
+    static const Preset room    { { 7.9f, 10.3f, 12.7f, 15.1f, 17.9f, 20.3f, 23.9f, 27.1f }, { 1.1f, 1.7f, 3.1f, 2.3f },
+                                  0.60f, 0.25f, 2.5f, 2000.0f, 0.08f, 0.70f, 0.7f };
+    static const Preset chamber { { 23.3f, 27.7f, 32.9f, 37.3f, 41.7f, 46.1f, 52.3f, 57.7f }, { 2.3f, 3.1f, 7.9f, 5.3f },
+                                  0.65f, 0.5f, 4.5f, 2500.0f, 0.15f, 0.55f, 0.7f };
+
+    switch (a)
+    {
+        case Algorithm::plate:   return plate;
+        case Algorithm::room:    return room;
+        case Algorithm::chamber: return chamber;
+        case Algorithm::hall:
+        default:                 return hall;
+    }
+}
+
+float FdnReverb::getLongestT60Seconds() noexcept
+{
+    float longest = 0.0f;
+    for (auto a : { Algorithm::hall, Algorithm::plate, Algorithm::room, Algorithm::chamber })
+        longest = juce::jmax(longest, getPreset(a).maxT60);
+
+    return longest;
+}
+
+void FdnReverb::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+
+    // Size for the longest line/diffuser of any preset plus modulation and interpolation headroom
+    float longestLineMs = 0.0f, longestDiffuserMs = 0.0f;
+    for (auto a : { Algorithm::hall, Algorithm::plate, Algorithm::room, Algorithm::chamber })
+    {
+        const auto& p = getPreset(a);
+        for (float ms : p.delayMs)
+            longestLineMs = juce::jmax(longestLineMs, ms + p.modDepthMs);
+        for (float ms : p.diffuserMs)
+            longestDiffuserMs = juce::jmax(longestDiffuserMs, ms);
+    }
+
+    const int lineSize = juce::nextPowerOfTwo((int) std::ceil(longestLineMs * 0.001 * sampleRate) + 4);
+    for (auto& line : lines)
+        line.assign((size_t) lineSize, 0.0f);
+    lineMask = lineSize - 1;
+
+    const int diffuserSize = juce::nextPowerOfTwo((int) std::ceil(longestDiffuserMs * 0.001 * sampleRate) + 2);
+    for (auto& d : diffusers)
+        d.assign((size_t) diffuserSize, 0.0f);
+    diffuserMask = diffuserSize - 1;
+
+    const int predelaySize = juce::nextPowerOfTwo((int) std::ceil(kMaxPredelayMs * 0.001 * sampleRate) + 1);
+    predelayLine.assign((size_t) predelaySize, 0.0f);
+    predelayMask = predelaySize - 1;
+    predelaySamples = juce::jmin(predelaySamples, predelayMask);
+
+    updateLayout();
+    updateFeedback();
+    reset();
+}
+
+void FdnReverb::reset() noexcept
+{
+    for (auto& line : lines)
+        std::fill(line.begin(), line.end(), 0.0f);
+    for (auto& d : diffusers)
+        std::fill(d.begin(), d.end(), 0.0f);
+    std::fill(predelayLine.begin(), predelayLine.end(), 0.0f);
+
+    dampState.fill(0.0f);
+    for (int i = 0; i < N; ++i)
+        lfoPhase[(size_t) i] = (float) i / (float) N;
+
+    writePos = 0;
+    diffuserPos = 0;
+    predelayPos = 0;
+}
+
+void FdnReverb::setAlgorithm(Algorithm newAlgorithm) noexcept
+{
+    if (newAlgorithm == algorithm)
+        return;
+
+    algorithm = newAlgorithm;
+    updateLayout();
+    updateFeedback();
+    reset();
+}
+
+void FdnReverb::setDecay(float decay0to1) noexcept
+{
+    decay0to1 = juce::jlimit(0.0f, 1.0f, decay0to1);
+    if (decay0to1 == decay)
+        return;
+
+    decay = decay0to1;
+    updateFeedback();
+}
+
+void FdnReverb::setTone(float tone0to1) noexcept
+{
+    tone0to1 = juce::jlimit(0.0f, 1.0f, tone0to1);
+    if (tone0to1 == tone)
+        return;
+
+    tone = tone0to1;
+    updateFeedback();
+}
+
+void FdnReverb::setPredelayMs(float milliseconds) noexcept
+{
+    const int samples = juce::roundToInt(juce::jlimit(0.0f, kMaxPredelayMs, milliseconds) * 0.001 * sampleRate);
+    predelaySamples = juce::jlimit(0, predelayMask, samples);
+}
+
+void FdnReverb::updateLayout() noexcept
+{
+    const auto& p = getPreset(algorithm);
+    const auto toSamples = [this] (float ms) { return (float) (ms * 0.001 * sampleRate); };
+
+    modDepth = toSamples(p.modDepthMs);
+    for (int i = 0; i < N; ++i)
+    {
+        // Integer base lengths keep the per-line decay gains exact; every line must outlast a chunk
+        lineLength[(size_t) i] = juce::jmax(modDepth + (float) kChunkSize + 2.0f, std::round(toSamples(p.delayMs[(size_t) i])));
+        lfoIncrement[(size_t) i] = p.modRateHz * (1.0f + 0.13f * (float) i) / (float) sampleRate;
+    }
+
+    for (int j = 0; j < kNumDiffusers; ++j)
+        diffuserLength[(size_t) j] = juce::jlimit(kChunkSize, diffuserMask, juce::roundToInt(toSamples(p.diffuserMs[(size_t) j])));
+
+    diffusion = p.diffusion;
+    width = p.width;
+}
+
+void FdnReverb::updateFeedback() noexcept
+{
+    const auto& p = getPreset(algorithm);
+
+    // Each pass through a line loses len / (T60 * fs) of 60 dB
+    const float t60 = p.minT60 * std::pow(p.maxT60 / p.minT60, decay);
+    const float normalise = 1.0f / std::sqrt((float) N);
+    for (int i = 0; i < N; ++i)
+        feedbackGain[(size_t) i] = normalise * std::pow(10.0f, -3.0f * lineLength[(size_t) i] / (t60 * (float) sampleRate));
+
+    const float cutoff = juce::jmin(p.minCutoffHz * std::exp2(4.0f * tone), 0.45f * (float) sampleRate);
+    dampCoef = 1.0f - std::exp(-juce::MathConstants<float>::twoPi * cutoff / (float) sampleRate);
+}
+
+void FdnReverb::process(float* left, float* right, int numSamples, float dryGain, float wetGain) noexcept
+{
+    if (predelayLine.empty())
+        return;
+
+    for (int start = 0; start < numSamples; start += kChunkSize)
+        processChunk(left + start, right != nullptr ? right + start : nullptr,
+                     juce::jmin(kChunkSize, numSamples - start), dryGain, wetGain);
+}
+
+// Every line and diffuser is longer than a chunk, so everything a chunk reads was written by an
+// earlier one. That lets each stage run across the whole chunk: the line reads, the Hadamard
+// butterflies and the write-back are straight loops over samples instead of a per-sample network.
+void FdnReverb::processChunk(float* left, float* right, int numSamples, float dryGain, float wetGain) noexcept
+{
+    Chunk x;
+
+    // Mono sum through the predelay
+    for (int n = 0; n < numSamples; ++n)
+    {
+        predelayLine[(size_t) ((predelayPos + n) & predelayMask)] = right != nullptr ? 0.5f * (left[n] + right[n]) : left[n];
+        x[(size_t) n] = predelayLine[(size_t) ((predelayPos + n - predelaySamples) & predelayMask)];
+    }
+    predelayPos = (predelayPos + numSamples) & predelayMask;
+
+    // Input diffusion, one allpass at a time
+    for (int j = 0; j < kNumDiffusers; ++j)
+    {
+        auto& d = diffusers[(size_t) j];
+        const int length = diffuserLength[(size_t) j];
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const float delayed = d[(size_t) ((diffuserPos + n - length) & diffuserMask)];
+            const float v = x[(size_t) n] - diffusion * delayed;
+            d[(size_t) ((diffuserPos + n) & diffuserMask)] = v;
+            x[(size_t) n] = delayed + diffusion * v;
+        }
+    }
+    diffuserPos = (diffuserPos + numSamples) & diffuserMask;
+
+    // Line reads. The modulated delay is held for a chunk; at these depths and rates it moves by
+    // a few hundredths of a sample per chunk.
+    std::array<Chunk, N> y;
+    for (int i = 0; i < N; ++i)
+    {
+        const float delay = lineLength[(size_t) i] + modDepth * parabolicSine(lfoPhase[(size_t) i]);
+        lfoPhase[(size_t) i] += lfoIncrement[(size_t) i] * (float) numSamples;
+        if (lfoPhase[(size_t) i] >= 1.0f)
+            lfoPhase[(size_t) i] -= 1.0f;
+
+        const int whole = (int) delay;
+        const float frac = delay - (float) whole;
+        const int readPos = (writePos - whole - 1) & lineMask; // sample just past the read point
+        auto& out = y[(size_t) i];
+
+        if (readPos + numSamples + 1 <= lineMask + 1)
+        {
+            const float* src = lines[(size_t) i].data() + readPos;
+            for (int n = 0; n < numSamples; ++n)
+                out[(size_t) n] = src[n + 1] + frac * (src[n] - src[n + 1]);
+        }
+        else
+        {
+            const auto& line = lines[(size_t) i];
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const float a = line[(size_t) ((readPos + n + 1) & lineMask)];
+                const float b = line[(size_t) ((readPos + n) & lineMask)];
+                out[(size_t) n] = a + frac * (b - a);
+            }
+        }
+    }
+
+    // Across the lines per sample, so the eight one-pole recursions run side by side
+    for (int n = 0; n < numSamples; ++n)
+        for (int i = 0; i < N; ++i)
+        {
+            dampState[(size_t) i] += dampCoef * (y[(size_t) i][(size_t) n] - dampState[(size_t) i]);
+            y[(size_t) i][(size_t) n] = dampState[(size_t) i] * feedbackGain[(size_t) i];
+        }
+
+    // 8-point fast Walsh-Hadamard transform, each butterfly across the whole chunk.
+    // Unnormalised; the 1/sqrt(8) is folded into the feedback gains.
+    for (int h = 1; h < N; h <<= 1)
+        for (int i = 0; i < N; i += 2 * h)
+            for (int k = i; k < i + h; ++k)
+            {
+                auto& a = y[(size_t) k];
+                auto& b = y[(size_t) (k + h)];
+                for (int n = 0; n < numSamples; ++n)
+                {
+                    const float sum = a[(size_t) n] + b[(size_t) n];
+                    b[(size_t) n] = a[(size_t) n] - b[(size_t) n];
+                    a[(size_t) n] = sum;
+                }
+            }
+
+    // Inject the diffused input, write back, and tap the outputs from what went into the lines
+    Chunk wetL {}, wetR {};
+    for (int i = 0; i < N; ++i)
+    {
+        auto& line = lines[(size_t) i];
+        auto& v = y[(size_t) i];
+        const float inputGain = kInputGain * kInputSign[(size_t) i];
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            v[(size_t) n] += inputGain * x[(size_t) n];
+            line[(size_t) ((writePos + n) & lineMask)] = v[(size_t) n];
+            wetL[(size_t) n] += kLeftTap[(size_t) i] * v[(size_t) n];
+            wetR[(size_t) n] += kRightTap[(size_t) i] * v[(size_t) n];
+        }
+    }
+    writePos = (writePos + numSamples) & lineMask;
+
+    const float wet = wetGain * kOutputGain;
+    const float side = 0.5f * width;
+
+    if (right != nullptr)
+    {
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const float m = 0.5f * (wetL[(size_t) n] + wetR[(size_t) n]);
+            const float s = side * (wetL[(size_t) n] - wetR[(size_t) n]);
+            left[n] = dryGain * left[n] + wet * (m + s);
+            right[n] = dryGain * right[n] + wet * (m - s);
+        }
+    }
+    else
+    {
+        for (int n = 0; n < numSamples; ++n)
+            left[n] = dryGain * left[n] + wet * 0.5f * (wetL[(size_t) n] + wetR[(size_t) n]);
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+// =============================================================================
+// FdnReverb - 8-line feedback delay network with per-algorithm presets
+//
+// Signal path: mono sum -> predelay -> series allpass diffusers -> 8 delay
+// lines whose outputs are damped (one-pole low-pass), scaled for the target
+// decay time and mixed back in through an 8x8 Hadamard matrix (fast
+// Walsh-Hadamard transform). Each line's read point is slowly modulated to
+// break up metallic ringing. Line lengths, diffusion, decay range, modulation
+// and stereo width come from the algorithm preset (Hall, Plate, Room,
+// Chamber). Processing runs in 16-sample chunks, shorter than any line, so
+// the reads, the Hadamard butterflies and the write-back are plain loops over
+// the chunk that the compiler vectorises.
+//
+// prepare() allocates every line for the largest preset; process() and the
+// setters never allocate. Audio thread only.
+// =============================================================================
+class FdnReverb
+{
+public:
+    enum class Algorithm
+    {
+        hall,
+        plate,
+        room,
+        chamber
+    };
+
+    static constexpr int kNumLines = 8;
+    static constexpr int kNumDiffusers = 4;
+    static constexpr float kMaxPredelayMs = 250.0f;
+
+    // The longest -60 dB decay any preset reaches (decay 1), excluding predelay.
+    static float getLongestT60Seconds() noexcept;
+
+    void prepare(double sampleRate);
+    void reset() noexcept;
+
+    // Changing algorithm clears the tail.
+    void setAlgorithm(Algorithm newAlgorithm) noexcept;
+    void setDecay(float decay0to1) noexcept;
+    void setTone(float tone0to1) noexcept;
+    void setPredelayMs(float milliseconds) noexcept;
+
+    // In place: out = in * dryGain + reverb * wetGain. right may be null for mono.
+    void process(float* left, float* right, int numSamples, float dryGain, float wetGain) noexcept;
+
+private:
+    struct Preset
+    {
+        std::array<float, kNumLines> delayMs;
+        std::array<float, kNumDiffusers> diffuserMs;
+        float diffusion;      // allpass gain
+        float minT60, maxT60; // seconds at decay 0 and 1
+        float minCutoffHz;    // damping cutoff at tone 0; tone 1 opens it up 16x
+        float modDepthMs;
+        float modRateHz;
+        float width;
+    };
+
+    static constexpr int kChunkSize = 16;
+    using Chunk = std::array<float, kChunkSize>;
+
+    static const Preset& getPreset(Algorithm a) noexcept;
+
+    void updateLayout() noexcept;   // line and diffuser lengths, modulation
+    void updateFeedback() noexcept; // per-line decay gains and damping
+    void processChunk(float* left, float* right, int numSamples, float dryGain, float wetGain) noexcept;
+
+    double sampleRate = 44100.0;
+    Algorithm algorithm = Algorithm::hall;
+    float decay = 0.5f;
+    float tone = 0.5f;
+
+    // All lines share one power-of-two size and write position
+    std::array<std::vector<float>, kNumLines> lines;
+    int lineMask = 0;
+    int writePos = 0;
+
+    std::array<float, kNumLines> lineLength {}; // samples, fractional part used by the modulated read
+    std::array<float, kNumLines> feedbackGain {};
+    std::array<float, kNumLines> dampState {};
+    float dampCoef = 1.0f;
+
+    std::array<float, kNumLines> lfoPhase {};
+    std::array<float, kNumLines> lfoIncrement {};
+    float modDepth = 0.0f; // samples
+
+    std::array<std::vector<float>, kNumDiffusers> diffusers;
+    std::array<int, kNumDiffusers> diffuserLength {};
+    int diffuserMask = 0;
+    int diffuserPos = 0;
+    float diffusion = 0.0f;
+
+    std::vector<float> predelayLine;
+    int predelayMask = 0;
+    int predelayPos = 0;
+    int predelaySamples = 0;
+
+    float width = 1.0f;
+};
@@ -1,4 +1,5 @@
 #include "FxChain.h"
+#include "../Diagnostics/TraceRecorder.h"
 
 FxChain::FxChain(juce::AudioProcessorValueTreeState& state)
     : apvts(state)
@@ -91,17 +92,57 @@ FxChain::FxChain(juce::AudioProcessorValueTreeState& state)
         modules.add(entry.release());
     }
 
+    for (auto* entry : modules)
+        entry->module->setScratchArena(&scratchArena);
+
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    profiler = std::make_unique<ModuleProfiler>(modules.size() + 1);
+#endif
+
     buildDefaultOrder();
 }
 
 void FxChain::buildDefaultOrder()
 {
-    order.clear();
+    juce::StringArray defaultOrder;
     for (auto* entry : modules)
     {
         if (entry->kind == ModuleKind::Effect)
-            order.add(entry->module->getId());
+            defaultOrder.add(entry->module->getId());
     }
+
+    const juce::ScopedLock sl(orderWriteLock);
+    publishOrder(defaultOrder);
+}
+
+// Builds the module pointer lists for an already validated effect order and swaps them in.
+// Must be called with orderWriteLock held.
+void FxChain::publishOrder(const juce::StringArray& effectIds)
+{
+    auto next = std::make_unique<ProcessOrder>();
+    next->effectIds = effectIds;
+    next->effects.reserve((size_t)effectIds.size());
+    next->effectSlots.reserve((size_t)effectIds.size());
+
+    for (const auto& id : effectIds)
+    {
+        if (auto* entry = findModuleById(id))
+        {
+            next->effects.push_back(entry->module.get());
+            next->effectSlots.push_back(modules.indexOf(entry));
+        }
+    }
+
+    for (int i = 0; i < modules.size(); ++i)
+    {
+        if (modules[i]->kind == ModuleKind::Generator)
+        {
+            next->generators.push_back(modules[i]->module.get());
+            next->generatorSlots.push_back(i);
+        }
+    }
+
+    processOrder.publish(std::move(next));
 }
 
 FxChain::ModuleEntry* FxChain::findModuleById(const juce::String& id) const
@@ -116,9 +157,15 @@ FxChain::ModuleEntry* FxChain::findModuleById(const juce::String& id) const
 
 void FxChain::prepare(const juce::dsp::ProcessSpec& spec)
 {
+    scratchArena.prepare((int)spec.numChannels, (int)spec.maximumBlockSize);
+
     for (auto* entry : modules)
         entry->module->prepare(spec);
 
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    profiler->prepare(spec.sampleRate);
+#endif
+
     genBuffer.setSize((int)spec.numChannels, (int)spec.maximumBlockSize);
     dryGenBuffer.setSize((int)spec.numChannels, (int)spec.maximumBlockSize);
 }
@@ -134,32 +181,87 @@ void FxChain::process(juce::AudioBuffer<float>& buffer,
                       ModMatrix& modMatrix,
                       const FxTransportInfo& transport)
 {
+    ROCKET_TRACE_SCOPE("FxChain::process");
+
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
+    // Split into control-rate sub-blocks only while Amount is moving; a steady Amount needs one pass.
+    // Sub-blocks never exceed the prepared block size, so a host block larger than promised still
+    // gets full-length scratch buffers.
+    const int controlSize = amount.isSmoothing() ? getControlBlockSize() : numSamples;
+    const int subBlockSize = juce::jmax(1, juce::jmin(controlSize, scratchArena.getMaxSamples()));
 
-    // Set macro value for modulation
-    modMatrix.setMacroValue(amount.getCurrentValue());
+    const RcuSnapshot<ProcessOrder>::ReadScope snapshot(processOrder);
 
-    // Process generators first (they add to the buffer)
-    for (auto* entry : modules)
-    {
-        if (entry->kind == ModuleKind::Generator)
-            entry->module->process(buffer, modMatrix, transport);
-    }
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    profiler->beginBlock();
+    const auto chainStart = ModuleProfiler::Clock::now();
+#endif
 
-    // Process effects in order
-    for (const auto& id : order)
+    // Run the chain in control-rate sub-blocks so Amount modulation follows the smoother
+    // instead of stepping at host block edges. The sub-buffer only refers to the host data.
+    for (int start = 0; start < numSamples; start += subBlockSize)
     {
-        if (auto* entry = findModuleById(id))
-        {
-            if (entry->kind == ModuleKind::Effect)
-                entry->module->process(buffer, modMatrix, transport);
-        }
+        const int count = juce::jmin(subBlockSize, numSamples - start);
+        juce::AudioBuffer<float> subBlock(buffer.getArrayOfWritePointers(), numChannels, start, count);
+
+        // Set macro value for modulation
+        modMatrix.setMacroValue(amount.getCurrentValue());
+
+        // Process generators first (they add to the buffer)
+        for (size_t i = 0; i < snapshot->generators.size(); ++i)
+            processModule(*snapshot->generators[i], snapshot->generatorSlots[i], subBlock, modMatrix, transport);
+
+        // Process effects in order
+        for (size_t i = 0; i < snapshot->effects.size(); ++i)
+            processModule(*snapshot->effects[i], snapshot->effectSlots[i], subBlock, modMatrix, transport);
+
+        amount.skip(count);
     }
+
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    profiler->addSince(modules.size(), chainStart);
+    profiler->endBlock(numSamples);
+#endif
+}
+
+void FxChain::processModule(FxModule& module, int slot, juce::AudioBuffer<float>& buffer,
+                            ModMatrix& modMatrix, const FxTransportInfo& transport)
+{
+    ROCKET_TRACE_SCOPE(module.getId().toRawUTF8());
+
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    const auto start = ModuleProfiler::Clock::now();
+    module.process(buffer, modMatrix, transport);
+    profiler->addSince(slot, start);
+#else
+    juce::ignoreUnused(slot);
+    module.process(buffer, modMatrix, transport);
+#endif
+}
+
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+ModuleProfiler::Stats FxChain::getModuleStats(const juce::String& moduleId) const
+{
+    return profiler->getStats(modules.indexOf(findModuleById(moduleId)));
+}
+
+ModuleProfiler::Stats FxChain::getChainStats() const
+{
+    return profiler->getStats(modules.size());
+}
+#endif
+
+void FxChain::setControlBlockSize(int numSamples) noexcept
+{
+    controlBlockSize.store(juce::jlimit(1, 4096, numSamples), std::memory_order_relaxed);
 }
 
 void FxChain::moveModule(int fromIndex, int toIndex)
 {
+    const juce::ScopedLock sl(orderWriteLock);
+    auto order = processOrder.getLatest().effectIds;
+
     if (!juce::isPositiveAndBelow(fromIndex, order.size()) ||
         !juce::isPositiveAndBelow(toIndex, order.size()) ||
         fromIndex == toIndex)
@@ -168,11 +270,13 @@ void FxChain::moveModule(int fromIndex, int toIndex)
     auto id = order[fromIndex];
     order.remove(fromIndex);
     order.insert(toIndex, id);
+    publishOrder(order);
 }
 
 juce::StringArray FxChain::getModuleOrder() const
 {
-    return order;
+    const juce::ScopedLock sl(orderWriteLock);
+    return processOrder.getLatest().effectIds;
 }
 
 void FxChain::setModuleOrder(const juce::StringArray& newOrder)
@@ -181,8 +285,9 @@ void FxChain::setModuleOrder(const juce::StringArray& newOrder)
     juce::StringArray validOrder;
     for (const auto& id : newOrder)
     {
-        if (findModuleById(id) != nullptr)
-            validOrder.add(id);
+        auto* entry = findModuleById(id);
+        if (entry != nullptr && entry->kind == ModuleKind::Effect)
+            validOrder.addIfNotAlreadyThere(id);
     }
 
     // Add any missing effect modules
@@ -192,13 +297,15 @@ void FxChain::setModuleOrder(const juce::StringArray& newOrder)
             validOrder.add(entry->module->getId());
     }
 
-    order = validOrder;
+    const juce::ScopedLock sl(orderWriteLock);
+    publishOrder(validOrder);
 }
 
 void FxChain::appendState(juce::ValueTree& parent) const
 {
     juce::ValueTree chainTree("FXCHAIN");
-    
+    const auto order = getModuleOrder();
+
     for (int i = 0; i < order.size(); ++i)
     {
         juce::ValueTree orderEntry("MODULE");
@@ -2,6 +2,9 @@
 
 #include <JuceHeader.h>
 #include "Modules.h"
+#include "RcuSnapshot.h"
+#include "ModuleProfiler.h"
+#include <vector>
 
 class FxChain
 {
@@ -16,6 +19,11 @@ public:
 
     void reset();
 
+    // Control-rate engine: ModMatrix targets are re-evaluated every controlBlockSize samples.
+    static constexpr int kDefaultControlBlockSize = 32;
+    void setControlBlockSize(int numSamples) noexcept;
+    int getControlBlockSize() const noexcept { return controlBlockSize.load(std::memory_order_relaxed); }
+
     void moveModule(int fromIndex, int toIndex);
     juce::StringArray getModuleOrder() const;
     void setModuleOrder(const juce::StringArray& order);
@@ -23,6 +31,13 @@ public:
     void appendState(juce::ValueTree& parent) const;
     void restoreFromState(const juce::ValueTree& parent);
 
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    // Per-module CPU time for the developer panel; safe to call from any thread.
+    ModuleProfiler::Stats getModuleStats(const juce::String& moduleId) const;
+    ModuleProfiler::Stats getChainStats() const;
+    void resetProfilingPeaks() noexcept { profiler->resetPeaks(); }
+#endif
+
     static void addParameters(juce::AudioProcessorValueTreeState::ParameterLayout& layout);
     static void addParameterIDs(juce::StringArray& ids);
 
@@ -36,11 +51,35 @@ private:
     };
 
     juce::OwnedArray<ModuleEntry> modules;
-    juce::StringArray order; // effect-only order
+
+    // Precompiled processing order, rebuilt on the message thread and swapped in atomically
+    struct ProcessOrder
+    {
+        std::vector<FxModule*> generators;
+        std::vector<FxModule*> effects;
+        std::vector<int> generatorSlots; // index into modules, parallel to generators
+        std::vector<int> effectSlots;    // index into modules, parallel to effects
+        juce::StringArray effectIds; // effect-only order, for the UI and state
+    };
+
+    RcuSnapshot<ProcessOrder> processOrder;
+    juce::CriticalSection orderWriteLock; // serialises writers; never taken on the audio thread
+
+    std::atomic<int> controlBlockSize { kDefaultControlBlockSize };
+
+    ScratchArena scratchArena; // lent to modules for dry copies during process()
+
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    std::unique_ptr<ModuleProfiler> profiler; // one slot per module plus one for the whole chain
+#endif
 
     juce::AudioBuffer<float> genBuffer;
     juce::AudioBuffer<float> dryGenBuffer;
 
     void buildDefaultOrder();
+    void publishOrder(const juce::StringArray& effectIds);
     ModuleEntry* findModuleById(const juce::String& id) const;
+
+    void processModule(FxModule& module, int slot, juce::AudioBuffer<float>& buffer,
+                       ModMatrix& modMatrix, const FxTransportInfo& transport);
 };
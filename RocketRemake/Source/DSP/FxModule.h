@@ -1,6 +1,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "ScratchArena.h"
 
 class ModMatrix; // Forward declaration
 
@@ -14,11 +15,35 @@ struct FxTransportInfo
     double sampleRate = 44100.0;
 };
 
+// A parameter handle resolved once when the module is built, so the audio thread
+// never concatenates IDs or searches the APVTS. A missing parameter leaves value null.
+// index is the processor parameter index used by the ModMatrix target table.
+struct FxParam
+{
+    FxParam() = default;
+    FxParam(juce::AudioProcessorValueTreeState& state, const juce::String& paramID)
+        : id(paramID), value(state.getRawParameterValue(paramID))
+    {
+        if (auto* p = state.getParameter(paramID))
+            index = p->getParameterIndex();
+    }
+
+    float load(float fallback) const noexcept { return value != nullptr ? value->load() : fallback; }
+    int loadInt(int fallback) const noexcept { return value != nullptr ? juce::roundToInt(value->load()) : fallback; }
+    bool loadBool(bool fallback) const noexcept { return value != nullptr ? value->load() > 0.5f : fallback; }
+
+    juce::String id;
+    std::atomic<float>* value = nullptr;
+    int index = -1;
+};
+
 class FxModule
 {
 public:
     FxModule(juce::AudioProcessorValueTreeState& state, const juce::String& moduleId, ModuleKind kindIn)
-        : apvts(state), moduleID(moduleId), kind(kindIn) {}
+        : apvts(state), moduleID(moduleId), kind(kindIn),
+          enabledParam(state, moduleId + "_enabled"),
+          mixParam(state, moduleId + "_mix") {}
 
     virtual ~FxModule() = default;
 
@@ -26,20 +51,29 @@ public:
     virtual void reset() = 0;
     virtual void process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatrix, const FxTransportInfo& transport) = 0;
 
+    // Temporary buffers for process(); owned by the chain and sized in its prepare().
+    void setScratchArena(ScratchArena* arena) noexcept { scratch = arena; }
+
     const juce::String& getId() const { return moduleID; }
     ModuleKind getKind() const { return kind; }
 
-    bool isEnabled() const
-    {
-        if (auto* p = apvts.getRawParameterValue(moduleID + "_enabled"))
-            return p->load() > 0.5f;
-        return true;
-    }
+    bool isEnabled() const { return enabledParam.loadBool(true); }
 
     float getMix(ModMatrix& modMatrix) const;
 
 protected:
+    // Resolves "<moduleID>_<suffix>"; call from the constructor only.
+    FxParam makeParam(const juce::String& suffix) { return { apvts, moduleID + "_" + suffix }; }
+
+    // Current value of a parameter with any ModMatrix modulation applied.
+    float getModulated(const FxParam& param, ModMatrix& modMatrix, float fallback) const;
+
     juce::AudioProcessorValueTreeState& apvts;
     juce::String moduleID;
     ModuleKind kind;
+    ScratchArena* scratch = nullptr;
+
+private:
+    FxParam enabledParam;
+    FxParam mixParam;
 };
@@ -3,6 +3,17 @@
 ModMatrix::ModMatrix(juce::AudioProcessorValueTreeState& state)
     : apvts(state)
 {
+    numParams = apvts.processor.getParameters().size();
+    for (auto* param : apvts.processor.getParameters())
+        parameters.push_back(dynamic_cast<juce::RangedAudioParameter*>(param));
+    targetValues.assign((size_t)numParams, 0.0f);
+    commit();
+}
+
+ModMatrix::~ModMatrix()
+{
+    if (activeTable != nullptr)
+        table.release();
 }
 
 void ModMatrix::prepare(double /*sampleRate*/, int /*samplesPerBlock*/)
@@ -12,39 +23,146 @@ void ModMatrix::prepare(double /*sampleRate*/, int /*samplesPerBlock*/)
 void ModMatrix::setMacroValue(float macro)
 {
     macroValue = juce::jlimit(0.0f, 1.0f, macro);
+    activeTable = table.acquire();
+    evaluateSlots();
 }
 
 float ModMatrix::getModulatedParamValue(const juce::String& paramID, float baseValue) const
 {
-    float modded = baseValue;
+    return getModulatedParamValue(getParamIndex(paramID), baseValue);
+}
+
+int ModMatrix::getParamIndex(const juce::String& paramID) const
+{
+    if (auto* p = apvts.getParameter(paramID))
+        return p->getParameterIndex();
+    return -1;
+}
+
+// Compiles the assignments into a fresh table and publishes it. Must be called with writeLock held.
+void ModMatrix::commit()
+{
+    if (batchDepth > 0)
+    {
+        batchDirty = true;
+        return;
+    }
+
+    auto next = std::make_unique<Table>();
+    next->targetModes.assign((size_t)numParams, TargetMode::None);
+    next->slots.reserve((size_t)assignments.size());
 
     for (const auto& a : assignments)
     {
-        if (a.paramID == paramID)
+        const int index = getParamIndex(a.paramID);
+
+        // Unknown IDs are kept for state round-trips but never evaluated; for duplicate
+        // targets the first assignment wins, as with the old linear scan.
+        if (!juce::isPositiveAndBelow(index, numParams)
+            || next->targetModes[(size_t)index] != TargetMode::None)
+            continue;
+
+        next->slots.push_back({ index, a.amount, a.useRange, a.min, a.max });
+        next->targetModes[(size_t)index] = a.useRange ? TargetMode::Absolute : TargetMode::Offset;
+    }
+
+    next->generation = nextGeneration++;
+    next->checksum = next->computeChecksum();
+    table.publish(std::move(next));
+    batchDirty = false;
+}
+
+// FNV-1a over the generation, every slot field and the target modes.
+std::uint64_t ModMatrix::Table::computeChecksum() const noexcept
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    const auto mix = [&hash] (const void* data, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= static_cast<const std::uint8_t*>(data)[i];
+            hash *= 1099511628211ull;
+        }
+    };
+
+    mix(&generation, sizeof(generation));
+    for (const auto& slot : slots)
+    {
+        mix(&slot.paramIndex, sizeof(slot.paramIndex));
+        mix(&slot.amount, sizeof(slot.amount));
+        mix(&slot.useRange, sizeof(slot.useRange));
+        mix(&slot.min, sizeof(slot.min));
+        mix(&slot.max, sizeof(slot.max));
+    }
+    mix(targetModes.data(), targetModes.size() * sizeof(TargetMode));
+    return hash;
+}
+
+ModMatrix::TableCheck ModMatrix::checkActiveTable() const noexcept
+{
+    TableCheck check;
+    if (activeTable == nullptr)
+        return check;
+
+    check.generation = activeTable->generation;
+    check.consistent = activeTable->checksum == activeTable->computeChecksum();
+
+    // Every slot owns exactly one target with the matching mode, and no other target is active
+    size_t numActive = 0;
+    for (auto mode : activeTable->targetModes)
+        numActive += mode != TargetMode::None ? 1 : 0;
+    check.consistent = check.consistent && numActive == activeTable->slots.size();
+
+    for (const auto& slot : activeTable->slots)
+        check.consistent = check.consistent
+                           && juce::isPositiveAndBelow(slot.paramIndex, (int)activeTable->targetModes.size())
+                           && activeTable->targetModes[(size_t)slot.paramIndex]
+                                  == (slot.useRange ? TargetMode::Absolute : TargetMode::Offset);
+
+    return check;
+}
+
+void ModMatrix::evaluateSlots() noexcept
+{
+    for (const auto& slot : activeTable->slots)
+    {
+        float value;
+        if (slot.useRange)
         {
-            if (a.useRange)
-            {
-                // Interpolate between min and max based on macro and amount/direction
-                float t = macroValue * a.amount;
-                if (a.amount >= 0.0f)
-                    modded = a.min + t * (a.max - a.min);
-                else
-                    modded = a.max + (-t) * (a.min - a.max);
-            }
+            // Interpolate between min and max based on macro and amount/direction
+            const float t = macroValue * slot.amount;
+            if (slot.amount >= 0.0f)
+                value = slot.min + t * (slot.max - slot.min);
             else
-            {
-                // Direct modulation: add amount * macro to base value
-                modded = baseValue + a.amount * macroValue;
-            }
-            break;
+                value = slot.max + (-t) * (slot.min - slot.max);
+        }
+        else
+        {
+            // Direct modulation: offset added to the base value on read
+            value = slot.amount * macroValue;
         }
+
+        targetValues[(size_t)slot.paramIndex] = value;
     }
+}
+
+ModMatrix::ScopedBatch::ScopedBatch(ModMatrix& m) : matrix(m)
+{
+    const juce::ScopedLock sl(matrix.writeLock);
+    ++matrix.batchDepth;
+}
 
-    return modded;
+ModMatrix::ScopedBatch::~ScopedBatch()
+{
+    const juce::ScopedLock sl(matrix.writeLock);
+    if (--matrix.batchDepth == 0 && matrix.batchDirty)
+        matrix.commit();
 }
 
 void ModMatrix::addAssignment(const Assignment& a)
 {
+    const juce::ScopedLock sl(writeLock);
+
     // Remove any existing assignment for the same param
     for (int i = assignments.size(); --i >= 0;)
     {
@@ -52,21 +170,30 @@ void ModMatrix::addAssignment(const Assignment& a)
             assignments.remove(i);
     }
     assignments.add(a);
+    commit();
 }
 
 void ModMatrix::removeAssignment(int index)
 {
+    const juce::ScopedLock sl(writeLock);
+
     if (juce::isPositiveAndBelow(index, assignments.size()))
+    {
         assignments.remove(index);
+        commit();
+    }
 }
 
 void ModMatrix::clear()
 {
+    const juce::ScopedLock sl(writeLock);
     assignments.clear();
+    commit();
 }
 
 void ModMatrix::appendState(juce::ValueTree& parent) const
 {
+    const juce::ScopedLock sl(writeLock);
     juce::ValueTree modTree("MODMATRIX");
 
     for (const auto& a : assignments)
@@ -89,6 +216,7 @@ void ModMatrix::restoreFromState(const juce::ValueTree& parent)
     if (!modTree.isValid())
         return;
 
+    const juce::ScopedLock sl(writeLock);
     assignments.clear();
 
     for (int i = 0; i < modTree.getNumChildren(); ++i)
@@ -105,6 +233,8 @@ void ModMatrix::restoreFromState(const juce::ValueTree& parent)
             assignments.add(a);
         }
     }
+
+    commit();
 }
 
 void ModMatrix::addParameters(juce::AudioProcessorValueTreeState::ParameterLayout& /*layout*/)
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "RcuSnapshot.h"
+#include <cstdint>
+#include <vector>
 
 class ModMatrix
 {
@@ -15,26 +18,126 @@ public:
     };
 
     explicit ModMatrix(juce::AudioProcessorValueTreeState& state);
+    ~ModMatrix();
 
     void prepare(double sampleRate, int samplesPerBlock);
+
+    // Audio thread: picks up the latest committed assignment table and evaluates all targets.
     void setMacroValue(float macro);
     float getMacroValue() const { return macroValue; }
 
+    // Hot path (audio thread): paramIndex is the processor parameter index (see FxParam::index).
+    float getModulatedParamValue(int paramIndex, float baseValue) const noexcept
+    {
+        if (activeTable == nullptr || !juce::isPositiveAndBelow(paramIndex, (int)activeTable->targetModes.size()))
+            return baseValue;
+
+        switch (activeTable->targetModes[(size_t)paramIndex])
+        {
+            case TargetMode::Offset:   return baseValue + targetValues[(size_t)paramIndex];
+            case TargetMode::Absolute: return targetValues[(size_t)paramIndex];
+            case TargetMode::None:     break;
+        }
+        return baseValue;
+    }
+
+    // Audio thread: lookup by ID for callers without a resolved FxParam.
     float getModulatedParamValue(const juce::String& paramID, float baseValue) const;
 
+    // Audio thread: calls fn(paramIndex, effectiveValue) for every parameter with an active assignment.
+    template <typename Fn>
+    void forEachModulatedTarget(Fn&& fn) const noexcept
+    {
+        if (activeTable == nullptr)
+            return;
+
+        for (size_t i = 0; i < activeTable->targetModes.size() && i < parameters.size(); ++i)
+        {
+            if (activeTable->targetModes[i] == TargetMode::None || parameters[i] == nullptr)
+                continue;
+
+            const auto* param = parameters[i];
+            fn((int)i, getModulatedParamValue((int)i, param->convertFrom0to1(param->getValue())));
+        }
+    }
+
+    // Editing (message thread). Each call commits a new table unless a ScopedBatch is active.
     void addAssignment(const Assignment& a);
     void removeAssignment(int index);
     void clear();
 
+    // Groups several edits into a single commit to the audio thread.
+    class ScopedBatch
+    {
+    public:
+        explicit ScopedBatch(ModMatrix& m);
+        ~ScopedBatch();
+
+    private:
+        ModMatrix& matrix;
+        JUCE_DECLARE_NON_COPYABLE(ScopedBatch)
+    };
+
     const juce::Array<Assignment>& getAssignments() const { return assignments; }
 
+    // Audio thread, diagnostics: the table pinned by the last setMacroValue(). consistent is false
+    // if its checksum or its slot/target-mode cross-references do not match what commit() built.
+    struct TableCheck
+    {
+        bool consistent = true;
+        std::uint32_t generation = 0; // increases with every commit
+    };
+
+    TableCheck checkActiveTable() const noexcept;
+
     void appendState(juce::ValueTree& parent) const;
     void restoreFromState(const juce::ValueTree& parent);
 
     static void addParameters(juce::AudioProcessorValueTreeState::ParameterLayout& layout);
 
 private:
+    enum class TargetMode : uint8_t { None, Offset, Absolute };
+
+    // One compiled assignment: a resolved target index plus its mapping.
+    struct Slot
+    {
+        int paramIndex = -1;
+        float amount = 0.0f;
+        bool useRange = false;
+        float min = 0.0f;
+        float max = 1.0f;
+    };
+
+    // Compiled, immutable form of the assignments shared with the audio thread
+    struct Table
+    {
+        std::vector<Slot> slots;
+        std::vector<TargetMode> targetModes; // dense, indexed by parameter index
+        std::uint32_t generation = 0;
+        std::uint64_t checksum = 0;          // computeChecksum() when committed
+
+        std::uint64_t computeChecksum() const noexcept;
+    };
+
+    int getParamIndex(const juce::String& paramID) const;
+    void commit();
+    void evaluateSlots() noexcept;
+
     juce::AudioProcessorValueTreeState& apvts;
     float macroValue = 0.0f;
+    int numParams = 0;
+    std::vector<juce::RangedAudioParameter*> parameters; // by processor parameter index, for base values
+
+    // Writer side: source of truth for the UI and state, guarded by writeLock
     juce::Array<Assignment> assignments;
+    juce::CriticalSection writeLock;
+    int batchDepth = 0;
+    bool batchDirty = false;
+    std::uint32_t nextGeneration = 1;
+
+    RcuSnapshot<Table> table;
+
+    // Audio thread only: the table pinned by the last setMacroValue() and its evaluated values
+    const Table* activeTable = nullptr;
+    std::vector<float> targetValues;
 };
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// =============================================================================
+// ModuleProfiler - per-module CPU time of the FX chain, for the developer panel
+//
+// The audio thread accumulates module time over one host block in plain locals,
+// then publishes it to one cache-line-padded counter per module with relaxed
+// atomic stores. The UI reads the counters whenever it likes; values may be one
+// block apart from each other, which is fine for display.
+//
+// Only compiled in when ROCKET_PROFILING is set (internal builds by default).
+// =============================================================================
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+
+class ModuleProfiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Stats
+    {
+        double currentMicros = 0.0; // last host block
+        double averageMicros = 0.0; // exponential average over roughly the last second
+        double peakMicros = 0.0;    // since the last resetPeaks()
+        double budgetMicros = 0.0;  // real time available for the last host block
+    };
+
+    // Counters are sized once, so the UI can keep reading across later prepare() calls.
+    explicit ModuleProfiler(int numSlots)
+        : counters((size_t) numSlots), blockNanos((size_t) numSlots, 0) {}
+
+    // Before processing starts.
+    void prepare(double newSampleRate) noexcept { sampleRate = newSampleRate; }
+
+    // Audio thread: start of a host block.
+    void beginBlock() noexcept
+    {
+        std::fill(blockNanos.begin(), blockNanos.end(), 0);
+    }
+
+    // Audio thread: adds the time since start to a module's total for this block.
+    void addSince(int slot, Clock::time_point start) noexcept
+    {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        if (juce::isPositiveAndBelow(slot, (int) blockNanos.size()))
+            blockNanos[(size_t) slot] += (std::int64_t) elapsed;
+    }
+
+    // Audio thread: end of a host block; publishes this block's totals.
+    void endBlock(int numSamples) noexcept
+    {
+        if (sampleRate <= 0.0)
+            return;
+
+        const double budgetNanos = 1.0e9 * numSamples / sampleRate;
+        budget.store(budgetNanos, std::memory_order_relaxed);
+
+        // ~1 s time constant regardless of block size
+        const double alpha = juce::jlimit(0.0, 1.0, numSamples / sampleRate);
+        const bool resetPeak = peakResetPending.exchange(false, std::memory_order_relaxed);
+
+        for (size_t i = 0; i < counters.size(); ++i)
+        {
+            auto& c = counters[i];
+            const double nanos = (double) blockNanos[i];
+            const double avg = c.average.load(std::memory_order_relaxed);
+            const double peak = resetPeak ? 0.0 : c.peak.load(std::memory_order_relaxed);
+
+            c.current.store(nanos, std::memory_order_relaxed);
+            c.average.store(avg + alpha * (nanos - avg), std::memory_order_relaxed);
+            c.peak.store(juce::jmax(peak, nanos), std::memory_order_relaxed);
+        }
+    }
+
+    // Any thread.
+    Stats getStats(int slot) const noexcept
+    {
+        Stats s;
+        s.budgetMicros = budget.load(std::memory_order_relaxed) * 1.0e-3;
+
+        if (juce::isPositiveAndBelow(slot, (int) counters.size()))
+        {
+            const auto& c = counters[(size_t) slot];
+            s.currentMicros = c.current.load(std::memory_order_relaxed) * 1.0e-3;
+            s.averageMicros = c.average.load(std::memory_order_relaxed) * 1.0e-3;
+            s.peakMicros = c.peak.load(std::memory_order_relaxed) * 1.0e-3;
+        }
+        return s;
+    }
+
+    // Any thread: peaks restart from the next processed block.
+    void resetPeaks() noexcept { peakResetPending.store(true, std::memory_order_relaxed); }
+
+private:
+    // One cache line per module so UI reads never false-share with audio-thread writes
+    // to a neighbouring module's counter.
+    struct alignas(64) Counter
+    {
+        std::atomic<double> current { 0.0 };
+        std::atomic<double> average { 0.0 };
+        std::atomic<double> peak { 0.0 };
+    };
+
+    std::vector<Counter> counters;
+    std::vector<std::int64_t> blockNanos; // audio thread only
+    double sampleRate = 0.0;
+
+    alignas(64) std::atomic<double> budget { 0.0 };
+    std::atomic<bool> peakResetPending { false };
+
+    JUCE_DECLARE_NON_COPYABLE(ModuleProfiler)
+};
+
+#endif
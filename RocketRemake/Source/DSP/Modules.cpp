@@ -2,13 +2,18 @@
 #include "ModMatrix.h"
 
 // =============================================================================
-// FxModule - getMix with modulation support
+// FxModule - mix and parameter reads with modulation support
 // =============================================================================
 float FxModule::getMix(ModMatrix& modMatrix) const
 {
-    if (auto* p = apvts.getRawParameterValue(moduleID + "_mix"))
-        return modMatrix.getModulatedParamValue(moduleID + "_mix", p->load());
-    return 1.0f;
+    return getModulated(mixParam, modMatrix, 1.0f);
+}
+
+float FxModule::getModulated(const FxParam& param, ModMatrix& modMatrix, float fallback) const
+{
+    if (param.value == nullptr)
+        return fallback;
+    return modMatrix.getModulatedParamValue(param.index, param.value->load());
 }
 
 // =============================================================================
@@ -17,13 +22,16 @@ float FxModule::getMix(ModMatrix& modMatrix) const
 ReverbModule::ReverbModule(juce::AudioProcessorValueTreeState& state)
     : FxModule(state, "reverb", ModuleKind::Effect)
 {
+    params.decay = makeParam("decay");
+    params.predelay = makeParam("predelay");
+    params.tone = makeParam("tone");
+    params.algorithm = makeParam("algorithm");
 }
 
 void ReverbModule::prepare(const juce::dsp::ProcessSpec& spec)
 {
     sampleRate = spec.sampleRate;
-    reverb.setSampleRate(spec.sampleRate);
-    reverb.reset();
+    reverb.prepare(spec.sampleRate);
 }
 
 void ReverbModule::reset()
@@ -39,33 +47,20 @@ void ReverbModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatri
     if (mix < 0.001f) return;
 
     // Get parameters
-    float decay = 0.5f, predelay = 0.0f, tone = 0.5f;
-    int algorithm = 0;
-
-    if (auto* p = apvts.getRawParameterValue("reverb_decay"))
-        decay = modMatrix.getModulatedParamValue("reverb_decay", p->load());
-    if (auto* p = apvts.getRawParameterValue("reverb_predelay"))
-        predelay = modMatrix.getModulatedParamValue("reverb_predelay", p->load());
-    if (auto* p = apvts.getRawParameterValue("reverb_tone"))
-        tone = modMatrix.getModulatedParamValue("reverb_tone", p->load());
-    if (auto* p = apvts.getRawParameterValue("reverb_algorithm"))
-        algorithm = juce::roundToInt(p->load());
-
-    juce::Reverb::Parameters params;
-    params.roomSize = juce::jlimit(0.0f, 1.0f, decay);
-    params.damping = juce::jlimit(0.0f, 1.0f, 1.0f - tone);
-    params.wetLevel = mix;
-    params.dryLevel = 1.0f - mix;
-    params.width = algorithm == 0 ? 1.0f : 0.7f; // Hall vs Plate
-    params.freezeMode = 0.0f;
-
-    reverb.setParameters(params);
+    const float decay = getModulated(params.decay, modMatrix, 0.5f);
+    const float tone = getModulated(params.tone, modMatrix, 0.5f);
+    const float predelayMs = getModulated(params.predelay, modMatrix, 20.0f);
+    const int algorithm = juce::jlimit(0, 3, params.algorithm.loadInt(0));
+
+    reverb.setAlgorithm(static_cast<FdnReverb::Algorithm>(algorithm));
+    reverb.setDecay(decay);
+    reverb.setTone(tone);
+    reverb.setPredelayMs(predelayMs);
 
     // Process
-    if (buffer.getNumChannels() >= 2)
-        reverb.processStereo(buffer.getWritePointer(0), buffer.getWritePointer(1), buffer.getNumSamples());
-    else
-        reverb.processMono(buffer.getWritePointer(0), buffer.getNumSamples());
+    reverb.process(buffer.getWritePointer(0),
+                   buffer.getNumChannels() >= 2 ? buffer.getWritePointer(1) : nullptr,
+                   buffer.getNumSamples(), 1.0f - mix, mix);
 }
 
 void ReverbModule::addParameters(juce::AudioProcessorValueTreeState::ParameterLayout& layout)
@@ -73,7 +68,7 @@ void ReverbModule::addParameters(juce::AudioProcessorValueTreeState::ParameterLa
     layout.add(std::make_unique<juce::AudioParameterBool>("reverb_enabled", "Reverb Enabled", true));
     layout.add(std::make_unique<juce::AudioParameterFloat>("reverb_mix", "Reverb Mix", 0.0f, 1.0f, 0.3f));
     layout.add(std::make_unique<juce::AudioParameterFloat>("reverb_decay", "Reverb Decay", 0.0f, 1.0f, 0.5f));
-    layout.add(std::make_unique<juce::AudioParameterFloat>("reverb_predelay", "Reverb Predelay", 0.0f, 200.0f, 20.0f));
+    layout.add(std::make_unique<juce::AudioParameterFloat>("reverb_predelay", "Reverb Predelay", 0.0f, kMaxPredelayMs, 20.0f));
     layout.add(std::make_unique<juce::AudioParameterFloat>("reverb_tone", "Reverb Tone", 0.0f, 1.0f, 0.5f));
     layout.add(std::make_unique<juce::AudioParameterChoice>("reverb_algorithm", "Reverb Algorithm", 
         juce::StringArray{"Hall", "Plate", "Room", "Chamber"}, 0));
@@ -85,6 +80,10 @@ void ReverbModule::addParameters(juce::AudioProcessorValueTreeState::ParameterLa
 DelayModule::DelayModule(juce::AudioProcessorValueTreeState& state, int delayIndex)
     : FxModule(state, "delay" + juce::String(delayIndex), ModuleKind::Effect), index(delayIndex)
 {
+    params.time = makeParam("time");
+    params.feedback = makeParam("feedback");
+    params.sync = makeParam("sync");
+    params.rhythm = makeParam("rhythm");
 }
 
 void DelayModule::prepare(const juce::dsp::ProcessSpec& spec)
@@ -121,20 +120,10 @@ void DelayModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatrix
     const float mix = getMix(modMatrix);
     if (mix < 0.001f) return;
 
-    const juce::String prefix = moduleID + "_";
-
-    float timeL = 0.25f, timeR = 0.25f, feedback = 0.4f;
-    bool sync = false;
-    int rhythm = 2;
-
-    if (auto* p = apvts.getRawParameterValue(prefix + "time"))
-        timeL = timeR = modMatrix.getModulatedParamValue(prefix + "time", p->load());
-    if (auto* p = apvts.getRawParameterValue(prefix + "feedback"))
-        feedback = modMatrix.getModulatedParamValue(prefix + "feedback", p->load());
-    if (auto* p = apvts.getRawParameterValue(prefix + "sync"))
-        sync = p->load() > 0.5f;
-    if (auto* p = apvts.getRawParameterValue(prefix + "rhythm"))
-        rhythm = juce::roundToInt(p->load());
+    const float timeL = getModulated(params.time, modMatrix, 0.25f);
+    const float feedback = getModulated(params.feedback, modMatrix, 0.4f);
+    const bool sync = params.sync.loadBool(false);
+    const int rhythm = params.rhythm.loadInt(2);
 
     // Calculate delay time in samples
     float delaySamplesL, delaySamplesR;
@@ -202,16 +191,24 @@ void DelayModule::addParameters(juce::AudioProcessorValueTreeState::ParameterLay
 FilterModule::FilterModule(juce::AudioProcessorValueTreeState& state, Type t, const juce::String& id)
     : FxModule(state, id, ModuleKind::Effect), type(t)
 {
+    params.cutoff = makeParam("cutoff");
+    params.slope = makeParam("slope");
 }
 
 void FilterModule::prepare(const juce::dsp::ProcessSpec& spec)
 {
     sampleRate = (float)spec.sampleRate;
+    // Give every stage second-order coefficients up front so later in-place updates never resize
+    const auto initial = juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, 1000.0f);
     for (auto& f : filters)
     {
+        *f.state = initial;
         f.prepare(spec);
         f.reset();
     }
+
+    lastCutoff = -1.0f;
+    lastSlope = -1;
 }
 
 void FilterModule::reset()
@@ -227,15 +224,8 @@ void FilterModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatri
     const float mix = getMix(modMatrix);
     if (mix < 0.001f) return;
 
-    float cutoff = 1000.0f;
-    int slope = 2; // dB per octave index: 0=6dB, 1=12dB, 2=24dB, 3=96dB
-
-    if (auto* p = apvts.getRawParameterValue(moduleID + "_cutoff"))
-        cutoff = modMatrix.getModulatedParamValue(moduleID + "_cutoff", p->load());
-    if (auto* p = apvts.getRawParameterValue(moduleID + "_slope"))
-        slope = juce::roundToInt(p->load());
-
-    cutoff = juce::jlimit(20.0f, 20000.0f, cutoff);
+    const float cutoff = juce::jlimit(20.0f, 20000.0f, getModulated(params.cutoff, modMatrix, 1000.0f));
+    const int slope = params.slope.loadInt(2); // dB per octave index: 0=6dB, 1=12dB, 2=24dB, 3=96dB
 
     // Calculate number of filter stages based on slope
     int stages = 1;
@@ -249,20 +239,29 @@ void FilterModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatri
     }
 
     // Update filter coefficients
-    juce::ReferenceCountedObjectPtr<juce::dsp::IIR::Coefficients<float>> coeffs;
-    if (type == Type::LowPass)
-        coeffs = juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, cutoff);
-    else
-        coeffs = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, cutoff);
+    if (cutoff != lastCutoff || slope != lastSlope)
+    {
+        // ArrayCoefficients are assigned in place, so no Coefficients objects are allocated here
+        const auto coeffs = type == Type::LowPass
+                              ? juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, cutoff)
+                              : juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(sampleRate, cutoff);
 
-    for (int i = 0; i < stages; ++i)
-        *filters[(size_t)i].state = *coeffs;
+        for (int i = 0; i < stages; ++i)
+            *filters[(size_t)i].state = coeffs;
+
+        lastCutoff = cutoff;
+        lastSlope = slope;
+    }
 
     // Store dry signal for mix
-    juce::AudioBuffer<float> dryBuffer;
-    if (mix < 0.999f)
+    jassert(scratch != nullptr);
+    ScratchArena::Lease dryLease(*scratch, buffer.getNumChannels(), buffer.getNumSamples());
+    auto& dryBuffer = dryLease.getBuffer();
+    const bool mixDry = mix < 0.999f && dryLease.isValid(); // no dry copy: the block is processed fully wet
+    if (mixDry)
     {
-        dryBuffer.makeCopyOf(buffer);
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            dryBuffer.copyFrom(ch, 0, buffer, ch, 0, buffer.getNumSamples());
     }
 
     // Process through filter stages
@@ -273,7 +272,7 @@ void FilterModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatri
         filters[(size_t)i].process(context);
 
     // Apply mix
-    if (mix < 0.999f)
+    if (mixDry)
     {
         for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
         {
@@ -303,6 +302,9 @@ void FilterModule::addParameters(juce::AudioProcessorValueTreeState::ParameterLa
 FlangerModule::FlangerModule(juce::AudioProcessorValueTreeState& state)
     : FxModule(state, "flanger", ModuleKind::Effect)
 {
+    params.rate = makeParam("rate");
+    params.depth = makeParam("depth");
+    params.feedback = makeParam("feedback");
 }
 
 void FlangerModule::prepare(const juce::dsp::ProcessSpec& spec)
@@ -328,14 +330,9 @@ void FlangerModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatr
     const float mix = getMix(modMatrix);
     if (mix < 0.001f) return;
 
-    float rate = 0.5f, depth = 0.5f, feedback = 0.5f;
-
-    if (auto* p = apvts.getRawParameterValue("flanger_rate"))
-        rate = modMatrix.getModulatedParamValue("flanger_rate", p->load());
-    if (auto* p = apvts.getRawParameterValue("flanger_depth"))
-        depth = modMatrix.getModulatedParamValue("flanger_depth", p->load());
-    if (auto* p = apvts.getRawParameterValue("flanger_feedback"))
-        feedback = modMatrix.getModulatedParamValue("flanger_feedback", p->load());
+    const float rate = getModulated(params.rate, modMatrix, 0.5f);
+    const float depth = getModulated(params.depth, modMatrix, 0.5f);
+    const float feedback = getModulated(params.feedback, modMatrix, 0.5f);
 
     const float phaseInc = rate / sampleRate;
     const float baseDelay = 1.0f; // ms
@@ -385,6 +382,9 @@ void FlangerModule::addParameters(juce::AudioProcessorValueTreeState::ParameterL
 PhaserModule::PhaserModule(juce::AudioProcessorValueTreeState& state)
     : FxModule(state, "phaser", ModuleKind::Effect)
 {
+    params.rate = makeParam("rate");
+    params.depth = makeParam("depth");
+    params.feedback = makeParam("feedback");
 }
 
 void PhaserModule::prepare(const juce::dsp::ProcessSpec& spec)
@@ -404,14 +404,9 @@ void PhaserModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatri
     const float mix = getMix(modMatrix);
     if (mix < 0.001f) return;
 
-    float rate = 0.5f, depth = 0.5f, feedback = 0.5f;
-
-    if (auto* p = apvts.getRawParameterValue("phaser_rate"))
-        rate = modMatrix.getModulatedParamValue("phaser_rate", p->load());
-    if (auto* p = apvts.getRawParameterValue("phaser_depth"))
-        depth = modMatrix.getModulatedParamValue("phaser_depth", p->load());
-    if (auto* p = apvts.getRawParameterValue("phaser_feedback"))
-        feedback = modMatrix.getModulatedParamValue("phaser_feedback", p->load());
+    const float rate = getModulated(params.rate, modMatrix, 0.5f);
+    const float depth = getModulated(params.depth, modMatrix, 0.5f);
+    const float feedback = getModulated(params.feedback, modMatrix, 0.5f);
 
     phaser.setRate(rate);
     phaser.setDepth(depth);
@@ -438,6 +433,8 @@ void PhaserModule::addParameters(juce::AudioProcessorValueTreeState::ParameterLa
 BitcrusherModule::BitcrusherModule(juce::AudioProcessorValueTreeState& state)
     : FxModule(state, "bitcrush", ModuleKind::Effect)
 {
+    params.bits = makeParam("bits");
+    params.downsample = makeParam("downsample");
 }
 
 void BitcrusherModule::prepare(const juce::dsp::ProcessSpec&)
@@ -458,12 +455,8 @@ void BitcrusherModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modM
     const float mix = getMix(modMatrix);
     if (mix < 0.001f) return;
 
-    float bits = 16.0f, downsample = 1.0f;
-
-    if (auto* p = apvts.getRawParameterValue("bitcrush_bits"))
-        bits = modMatrix.getModulatedParamValue("bitcrush_bits", p->load());
-    if (auto* p = apvts.getRawParameterValue("bitcrush_downsample"))
-        downsample = modMatrix.getModulatedParamValue("bitcrush_downsample", p->load());
+    const float bits = getModulated(params.bits, modMatrix, 16.0f);
+    const float downsample = getModulated(params.downsample, modMatrix, 1.0f);
 
     const int downsampleFactor = juce::jmax(1, juce::roundToInt(downsample));
     const float bitDepth = juce::jlimit(1.0f, 16.0f, bits);
@@ -507,6 +500,8 @@ void BitcrusherModule::addParameters(juce::AudioProcessorValueTreeState::Paramet
 DistortionModule::DistortionModule(juce::AudioProcessorValueTreeState& state)
     : FxModule(state, "distortion", ModuleKind::Effect)
 {
+    params.drive = makeParam("drive");
+    params.algorithm = makeParam("algorithm");
 }
 
 void DistortionModule::prepare(const juce::dsp::ProcessSpec& spec)
@@ -526,17 +521,13 @@ void DistortionModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modM
     const float mix = getMix(modMatrix);
     if (mix < 0.001f) return;
 
-    float drive = 0.5f;
-    int algorithm = 0;
-
-    if (auto* p = apvts.getRawParameterValue("distortion_drive"))
-        drive = modMatrix.getModulatedParamValue("distortion_drive", p->load());
-    if (auto* p = apvts.getRawParameterValue("distortion_algorithm"))
-        algorithm = juce::roundToInt(p->load());
+    const float drive = getModulated(params.drive, modMatrix, 0.5f);
+    const int algorithm = params.algorithm.loadInt(0);
 
     // Store dry signal
-    juce::AudioBuffer<float> dryBuffer;
-    dryBuffer.makeCopyOf(buffer);
+    jassert(scratch != nullptr);
+    const ScratchArena::Lease dryLease(*scratch, buffer);
+    const auto& dryBuffer = dryLease.getBuffer();
 
     juce::dsp::AudioBlock<float> block(buffer);
     auto osBlock = oversampling.processSamplesUp(block);
@@ -573,7 +564,10 @@ void DistortionModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modM
 
     oversampling.processSamplesDown(block);
 
-    // Apply mix
+    // Apply mix; without a dry copy the block stays fully wet
+    if (!dryLease.isValid())
+        return;
+
     for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
     {
         float* wet = buffer.getWritePointer(ch);
@@ -598,12 +592,31 @@ void DistortionModule::addParameters(juce::AudioProcessorValueTreeState::Paramet
 EQModule::EQModule(juce::AudioProcessorValueTreeState& state, const juce::String& id)
     : FxModule(state, id, ModuleKind::Effect)
 {
+    params.lowFreq = makeParam("low_freq");
+    params.lowGain = makeParam("low_gain");
+    params.midFreq = makeParam("mid_freq");
+    params.midGain = makeParam("mid_gain");
+    params.midQ = makeParam("mid_q");
+    params.midHiFreq = makeParam("midhi_freq");
+    params.midHiGain = makeParam("midhi_gain");
+    params.midHiQ = makeParam("midhi_q");
+    params.highFreq = makeParam("high_freq");
+    params.highGain = makeParam("high_gain");
 }
 
 void EQModule::prepare(const juce::dsp::ProcessSpec& spec)
 {
     sampleRate = (float)spec.sampleRate;
+
+    // Size each stage's coefficient storage here rather than on the first audio block
+    using ArrayCoeffs = juce::dsp::IIR::ArrayCoefficients<float>;
+    *eq.get<0>().state = ArrayCoeffs::makeLowShelf(sampleRate, 100.0f, 0.707f, 1.0f);
+    *eq.get<1>().state = ArrayCoeffs::makePeakFilter(sampleRate, 500.0f, 1.0f, 1.0f);
+    *eq.get<2>().state = ArrayCoeffs::makePeakFilter(sampleRate, 2000.0f, 1.0f, 1.0f);
+    *eq.get<3>().state = ArrayCoeffs::makeHighShelf(sampleRate, 8000.0f, 0.707f, 1.0f);
+
     eq.prepare(spec);
+    coefficientsValid = false;
 }
 
 void EQModule::reset()
@@ -615,45 +628,38 @@ void EQModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatrix, c
 {
     if (!isEnabled()) return;
 
-    const juce::String prefix = moduleID + "_";
-
     // Low band (shelf)
-    float lowFreq = 100.0f, lowGain = 0.0f;
-    if (auto* p = apvts.getRawParameterValue(prefix + "low_freq"))
-        lowFreq = modMatrix.getModulatedParamValue(prefix + "low_freq", p->load());
-    if (auto* p = apvts.getRawParameterValue(prefix + "low_gain"))
-        lowGain = modMatrix.getModulatedParamValue(prefix + "low_gain", p->load());
+    const float lowFreq = getModulated(params.lowFreq, modMatrix, 100.0f);
+    const float lowGain = getModulated(params.lowGain, modMatrix, 0.0f);
 
     // Mid band
-    float midFreq = 500.0f, midGain = 0.0f, midQ = 1.0f;
-    if (auto* p = apvts.getRawParameterValue(prefix + "mid_freq"))
-        midFreq = modMatrix.getModulatedParamValue(prefix + "mid_freq", p->load());
-    if (auto* p = apvts.getRawParameterValue(prefix + "mid_gain"))
-        midGain = modMatrix.getModulatedParamValue(prefix + "mid_gain", p->load());
-    if (auto* p = apvts.getRawParameterValue(prefix + "mid_q"))
-        midQ = modMatrix.getModulatedParamValue(prefix + "mid_q", p->load());
+    const float midFreq = getModulated(params.midFreq, modMatrix, 500.0f);
+    const float midGain = getModulated(params.midGain, modMatrix, 0.0f);
+    const float midQ = getModulated(params.midQ, modMatrix, 1.0f);
 
     // Mid-High band
-    float midHiFreq = 2000.0f, midHiGain = 0.0f, midHiQ = 1.0f;
-    if (auto* p = apvts.getRawParameterValue(prefix + "midhi_freq"))
-        midHiFreq = modMatrix.getModulatedParamValue(prefix + "midhi_freq", p->load());
-    if (auto* p = apvts.getRawParameterValue(prefix + "midhi_gain"))
-        midHiGain = modMatrix.getModulatedParamValue(prefix + "midhi_gain", p->load());
-    if (auto* p = apvts.getRawParameterValue(prefix + "midhi_q"))
-        midHiQ = modMatrix.getModulatedParamValue(prefix + "midhi_q", p->load());
+    const float midHiFreq = getModulated(params.midHiFreq, modMatrix, 2000.0f);
+    const float midHiGain = getModulated(params.midHiGain, modMatrix, 0.0f);
+    const float midHiQ = getModulated(params.midHiQ, modMatrix, 1.0f);
 
     // High band (shelf)
-    float highFreq = 8000.0f, highGain = 0.0f;
-    if (auto* p = apvts.getRawParameterValue(prefix + "high_freq"))
-        highFreq = modMatrix.getModulatedParamValue(prefix + "high_freq", p->load());
-    if (auto* p = apvts.getRawParameterValue(prefix + "high_gain"))
-        highGain = modMatrix.getModulatedParamValue(prefix + "high_gain", p->load());
+    const float highFreq = getModulated(params.highFreq, modMatrix, 8000.0f);
+    const float highGain = getModulated(params.highGain, modMatrix, 0.0f);
 
     // Update coefficients
-    *eq.get<0>().state = *juce::dsp::IIR::Coefficients<float>::makeLowShelf(sampleRate, lowFreq, 0.707f, juce::Decibels::decibelsToGain(lowGain));
-    *eq.get<1>().state = *juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate, midFreq, midQ, juce::Decibels::decibelsToGain(midGain));
-    *eq.get<2>().state = *juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate, midHiFreq, midHiQ, juce::Decibels::decibelsToGain(midHiGain));
-    *eq.get<3>().state = *juce::dsp::IIR::Coefficients<float>::makeHighShelf(sampleRate, highFreq, 0.707f, juce::Decibels::decibelsToGain(highGain));
+    const std::array<float, 10> bandValues { lowFreq, lowGain, midFreq, midGain, midQ,
+                                             midHiFreq, midHiGain, midHiQ, highFreq, highGain };
+    if (!coefficientsValid || bandValues != lastBandValues)
+    {
+        using ArrayCoeffs = juce::dsp::IIR::ArrayCoefficients<float>;
+        *eq.get<0>().state = ArrayCoeffs::makeLowShelf(sampleRate, lowFreq, 0.707f, juce::Decibels::decibelsToGain(lowGain));
+        *eq.get<1>().state = ArrayCoeffs::makePeakFilter(sampleRate, midFreq, midQ, juce::Decibels::decibelsToGain(midGain));
+        *eq.get<2>().state = ArrayCoeffs::makePeakFilter(sampleRate, midHiFreq, midHiQ, juce::Decibels::decibelsToGain(midHiGain));
+        *eq.get<3>().state = ArrayCoeffs::makeHighShelf(sampleRate, highFreq, 0.707f, juce::Decibels::decibelsToGain(highGain));
+
+        lastBandValues = bandValues;
+        coefficientsValid = true;
+    }
 
     juce::dsp::AudioBlock<float> block(buffer);
     juce::dsp::ProcessContextReplacing<float> context(block);
@@ -696,6 +702,11 @@ void EQModule::addParameters(juce::AudioProcessorValueTreeState::ParameterLayout
 TremoloModule::TremoloModule(juce::AudioProcessorValueTreeState& state)
     : FxModule(state, "tremolo", ModuleKind::Effect)
 {
+    params.rate = makeParam("rate");
+    params.depth = makeParam("depth");
+    params.sync = makeParam("sync");
+    params.rhythm = makeParam("rhythm");
+    params.waveform = makeParam("waveform");
 }
 
 void TremoloModule::prepare(const juce::dsp::ProcessSpec& spec)
@@ -715,21 +726,11 @@ void TremoloModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatr
     const float mix = getMix(modMatrix);
     if (mix < 0.001f) return;
 
-    float rate = 4.0f, depth = 0.5f;
-    bool sync = false;
-    int rhythm = 2;
-    int waveform = 0;
-
-    if (auto* p = apvts.getRawParameterValue("tremolo_rate"))
-        rate = modMatrix.getModulatedParamValue("tremolo_rate", p->load());
-    if (auto* p = apvts.getRawParameterValue("tremolo_depth"))
-        depth = modMatrix.getModulatedParamValue("tremolo_depth", p->load());
-    if (auto* p = apvts.getRawParameterValue("tremolo_sync"))
-        sync = p->load() > 0.5f;
-    if (auto* p = apvts.getRawParameterValue("tremolo_rhythm"))
-        rhythm = juce::roundToInt(p->load());
-    if (auto* p = apvts.getRawParameterValue("tremolo_waveform"))
-        waveform = juce::roundToInt(p->load());
+    const float rate = getModulated(params.rate, modMatrix, 4.0f);
+    const float depth = getModulated(params.depth, modMatrix, 0.5f);
+    const bool sync = params.sync.loadBool(false);
+    const int rhythm = params.rhythm.loadInt(2);
+    const int waveform = params.waveform.loadInt(0);
 
     // Calculate frequency
     float freq = rate;
@@ -800,6 +801,7 @@ void TremoloModule::addParameters(juce::AudioProcessorValueTreeState::ParameterL
 RingModModule::RingModModule(juce::AudioProcessorValueTreeState& state)
     : FxModule(state, "ringmod", ModuleKind::Effect)
 {
+    params.freq = makeParam("freq");
 }
 
 void RingModModule::prepare(const juce::dsp::ProcessSpec& spec)
@@ -819,10 +821,7 @@ void RingModModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatr
     const float mix = getMix(modMatrix);
     if (mix < 0.001f) return;
 
-    float freq = 440.0f;
-
-    if (auto* p = apvts.getRawParameterValue("ringmod_freq"))
-        freq = modMatrix.getModulatedParamValue("ringmod_freq", p->load());
+    const float freq = getModulated(params.freq, modMatrix, 440.0f);
 
     const float phaseInc = freq / sampleRate;
     const int numChannels = buffer.getNumChannels();
@@ -858,6 +857,9 @@ void RingModModule::addParameters(juce::AudioProcessorValueTreeState::ParameterL
 NoiseGenModule::NoiseGenModule(juce::AudioProcessorValueTreeState& state)
     : FxModule(state, "noisegen", ModuleKind::Generator)
 {
+    params.gain = makeParam("gain");
+    params.lp = makeParam("lp");
+    params.hp = makeParam("hp");
 }
 
 void NoiseGenModule::prepare(const juce::dsp::ProcessSpec& spec)
@@ -867,6 +869,8 @@ void NoiseGenModule::prepare(const juce::dsp::ProcessSpec& spec)
     auto hpCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, 200.0f);
     lpFilter.coefficients = lpCoeffs;
     hpFilter.coefficients = hpCoeffs;
+    lastLpFreq = 10000.0f;
+    lastHpFreq = 200.0f;
 }
 
 void NoiseGenModule::reset()
@@ -879,20 +883,25 @@ void NoiseGenModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMat
 {
     if (!isEnabled()) return;
 
-    float gain = 0.0f, lpFreq = 10000.0f, hpFreq = 200.0f;
-
-    if (auto* p = apvts.getRawParameterValue("noisegen_gain"))
-        gain = modMatrix.getModulatedParamValue("noisegen_gain", p->load());
-    if (auto* p = apvts.getRawParameterValue("noisegen_lp"))
-        lpFreq = modMatrix.getModulatedParamValue("noisegen_lp", p->load());
-    if (auto* p = apvts.getRawParameterValue("noisegen_hp"))
-        hpFreq = modMatrix.getModulatedParamValue("noisegen_hp", p->load());
+    const float gain = getModulated(params.gain, modMatrix, 0.0f);
+    const float lpFreq = getModulated(params.lp, modMatrix, 10000.0f);
+    const float hpFreq = getModulated(params.hp, modMatrix, 200.0f);
 
     if (gain < 0.001f) return;
 
     // Update filters
-    lpFilter.coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, juce::jlimit(200.0f, 20000.0f, lpFreq));
-    hpFilter.coefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, juce::jlimit(20.0f, 5000.0f, hpFreq));
+    const float lp = juce::jlimit(200.0f, 20000.0f, lpFreq);
+    const float hp = juce::jlimit(20.0f, 5000.0f, hpFreq);
+    if (lp != lastLpFreq)
+    {
+        *lpFilter.coefficients = juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, lp);
+        lastLpFreq = lp;
+    }
+    if (hp != lastHpFreq)
+    {
+        *hpFilter.coefficients = juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(sampleRate, hp);
+        lastHpFreq = hp;
+    }
 
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
@@ -924,6 +933,9 @@ void NoiseGenModule::addParameters(juce::AudioProcessorValueTreeState::Parameter
 ToneGenModule::ToneGenModule(juce::AudioProcessorValueTreeState& state)
     : FxModule(state, "tonegen", ModuleKind::Generator)
 {
+    params.gain = makeParam("gain");
+    params.freq = makeParam("freq");
+    params.waveform = makeParam("waveform");
 }
 
 void ToneGenModule::prepare(const juce::dsp::ProcessSpec& spec)
@@ -940,15 +952,9 @@ void ToneGenModule::process(juce::AudioBuffer<float>& buffer, ModMatrix& modMatr
 {
     if (!isEnabled()) return;
 
-    float gain = 0.0f, freq = 440.0f;
-    int waveform = 0;
-
-    if (auto* p = apvts.getRawParameterValue("tonegen_gain"))
-        gain = modMatrix.getModulatedParamValue("tonegen_gain", p->load());
-    if (auto* p = apvts.getRawParameterValue("tonegen_freq"))
-        freq = modMatrix.getModulatedParamValue("tonegen_freq", p->load());
-    if (auto* p = apvts.getRawParameterValue("tonegen_waveform"))
-        waveform = juce::roundToInt(p->load());
+    const float gain = getModulated(params.gain, modMatrix, 0.0f);
+    const float freq = getModulated(params.freq, modMatrix, 440.0f);
+    const int waveform = params.waveform.loadInt(0);
 
     if (gain < 0.001f) return;
 
@@ -2,10 +2,12 @@
 
 #include "FxModule.h"
 #include "ModMatrix.h"
+#include "FdnReverb.h"
 #include <array>
 
 // =============================================================================
 // REVERB MODULE - Multiple algorithms (Hall, Plate, Room, Chamber)
+// Feedback delay network; the algorithm picks the FdnReverb topology preset.
 // =============================================================================
 class ReverbModule : public FxModule
 {
@@ -17,8 +19,15 @@ public:
 
     static void addParameters(juce::AudioProcessorValueTreeState::ParameterLayout& layout);
 
+    static constexpr float kMaxPredelayMs = 200.0f;
+
+    // Longest tail the module can produce: the slowest preset decay plus the longest predelay.
+    static double getMaxTailSeconds() noexcept { return FdnReverb::getLongestT60Seconds() + kMaxPredelayMs * 0.001; }
+
 private:
-    juce::Reverb reverb;
+    FdnReverb reverb;
+
+    struct Params { FxParam decay, predelay, tone, algorithm; } params;
     double sampleRate = 44100.0;
 };
 
@@ -37,6 +46,7 @@ public:
 
 private:
     int index;
+    struct Params { FxParam time, feedback, sync, rhythm; } params;
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> delayL { 192000 };
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> delayR { 192000 };
     float sampleRate = 44100.0f;
@@ -62,9 +72,14 @@ public:
 
 private:
     Type type;
+    struct Params { FxParam cutoff, slope; } params;
     using FilterStage = juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>>;
     std::array<FilterStage, 16> filters; // Support up to 96dB/oct (16 stages x 6dB)
     float sampleRate = 44100.0f;
+
+    // Last values the coefficients were computed for; control sub-blocks skip unchanged updates
+    float lastCutoff = -1.0f;
+    int lastSlope = -1;
 };
 
 // =============================================================================
@@ -85,6 +100,8 @@ private:
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> delayR { 2048 };
     float sampleRate = 44100.0f;
     float phase = 0.0f;
+
+    struct Params { FxParam rate, depth, feedback; } params;
 };
 
 // =============================================================================
@@ -102,6 +119,8 @@ public:
 
 private:
     juce::dsp::Phaser<float> phaser;
+
+    struct Params { FxParam rate, depth, feedback; } params;
 };
 
 // =============================================================================
@@ -121,6 +140,8 @@ private:
     int downsampleCounter = 0;
     float heldSampleL = 0.0f;
     float heldSampleR = 0.0f;
+
+    struct Params { FxParam bits, downsample; } params;
 };
 
 // =============================================================================
@@ -138,6 +159,8 @@ public:
 
 private:
     juce::dsp::Oversampling<float> oversampling { 2, 2, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR };
+
+    struct Params { FxParam drive, algorithm; } params;
 };
 
 // =============================================================================
@@ -157,6 +180,17 @@ private:
     using EQStage = juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>>;
     juce::dsp::ProcessorChain<EQStage, EQStage, EQStage, EQStage> eq;
     float sampleRate = 44100.0f;
+
+    struct Params
+    {
+        FxParam lowFreq, lowGain;
+        FxParam midFreq, midGain, midQ;
+        FxParam midHiFreq, midHiGain, midHiQ;
+        FxParam highFreq, highGain;
+    } params;
+
+    std::array<float, 10> lastBandValues {}; // inputs of the current coefficients
+    bool coefficientsValid = false;
 };
 
 // =============================================================================
@@ -175,6 +209,8 @@ public:
 private:
     float phase = 0.0f;
     float sampleRate = 44100.0f;
+
+    struct Params { FxParam rate, depth, sync, rhythm, waveform; } params;
 };
 
 // =============================================================================
@@ -193,6 +229,8 @@ public:
 private:
     float phase = 0.0f;
     float sampleRate = 44100.0f;
+
+    struct Params { FxParam freq; } params;
 };
 
 // =============================================================================
@@ -212,6 +250,10 @@ private:
     juce::Random rng;
     juce::dsp::IIR::Filter<float> lpFilter, hpFilter;
     float sampleRate = 44100.0f;
+    float lastLpFreq = -1.0f;
+    float lastHpFreq = -1.0f;
+
+    struct Params { FxParam gain, lp, hp; } params;
 };
 
 // =============================================================================
@@ -230,4 +272,6 @@ public:
 private:
     float phase = 0.0f;
     float sampleRate = 44100.0f;
+
+    struct Params { FxParam gain, freq, waveform; } params;
 };
@@ -0,0 +1,540 @@
+#include "PartitionedConvolver.h"
+
+namespace
+{
+    constexpr float kMinIrSeconds = 0.05f;
+    constexpr float kDecayTolerance = 0.001f; // seconds; smaller decay changes keep the current IR
+
+    // JUCE real-only FFTs pack bins as interleaved (re, im) pairs
+    inline void deinterleave(const float* packed, float* re, float* im, int numBins) noexcept
+    {
+        for (int k = 0; k < numBins; ++k)
+        {
+            re[k] = packed[2 * k];
+            im[k] = packed[2 * k + 1];
+        }
+    }
+
+    inline void interleave(const float* re, const float* im, float* packed, int numBins) noexcept
+    {
+        for (int k = 0; k < numBins; ++k)
+        {
+            packed[2 * k] = re[k];
+            packed[2 * k + 1] = im[k];
+        }
+    }
+
+    // Fills the negative frequencies from the positive ones before an inverse real transform
+    inline void mirrorSpectrum(float* packed, int fftSize) noexcept
+    {
+        for (int k = 1; k < fftSize / 2; ++k)
+        {
+            packed[2 * (fftSize - k)] = packed[2 * k];
+            packed[2 * (fftSize - k) + 1] = -packed[2 * k + 1];
+        }
+    }
+
+    // acc += a * b over split complex planes
+    inline void multiplyAccumulate(float* accRe, float* accIm,
+                                   const float* aRe, const float* aIm,
+                                   const float* bRe, const float* bIm, int numBins) noexcept
+    {
+        for (int k = 0; k < numBins; ++k)
+        {
+            accRe[k] += aRe[k] * bRe[k] - aIm[k] * bIm[k];
+            accIm[k] += aRe[k] * bIm[k] + aIm[k] * bRe[k];
+        }
+    }
+}
+
+// =============================================================================
+class PartitionedConvolver::Worker : public juce::Thread
+{
+public:
+    explicit Worker(PartitionedConvolver& ownerIn) : juce::Thread("Rocket Convolution"), owner(ownerIn) {}
+    ~Worker() override { stopThread(1000); }
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            owner.runPendingJob();
+            owner.rebuildIfNeeded();
+            wait(-1); // notified when a job is posted or the decay changes
+        }
+    }
+
+private:
+    PartitionedConvolver& owner;
+};
+
+// =============================================================================
+void PartitionedConvolver::SpectrumHistory::resize(int partitions, int bins)
+{
+    numPartitions = juce::jmax(1, partitions);
+    numBins = bins;
+    re.assign((size_t) (numPartitions * numBins), 0.0f);
+    im.assign((size_t) (numPartitions * numBins), 0.0f);
+    newest = 0;
+}
+
+void PartitionedConvolver::SpectrumHistory::clear() noexcept
+{
+    std::fill(re.begin(), re.end(), 0.0f);
+    std::fill(im.begin(), im.end(), 0.0f);
+    newest = 0;
+}
+
+void PartitionedConvolver::SpectrumHistory::push(const float* newRe, const float* newIm) noexcept
+{
+    newest = (newest + 1) % numPartitions;
+    std::copy(newRe, newRe + numBins, re.data() + newest * numBins);
+    std::copy(newIm, newIm + numBins, im.data() + newest * numBins);
+}
+
+// =============================================================================
+PartitionedConvolver::PartitionedConvolver() = default;
+
+PartitionedConvolver::~PartitionedConvolver()
+{
+    stopWorker();
+    delete current;
+    delete pendingIr.exchange(nullptr);
+    delete retiredIr.exchange(nullptr);
+}
+
+void PartitionedConvolver::prepare(double newSampleRate, int newNumChannels, float decaySeconds)
+{
+    stopWorker();
+
+    sampleRate = newSampleRate;
+    numChannels = juce::jlimit(1, kMaxChannels, newNumChannels);
+
+    headBuffer.assign((size_t) (4 * kHeadSize), 0.0f);
+    buildBuffer.assign((size_t) (4 * kTailSize), 0.0f);
+    for (auto* scratch : { &audioScratch, &workerScratch })
+    {
+        scratch->buffer.assign((size_t) (4 * kTailSize), 0.0f);
+        scratch->accRe.assign((size_t) kTailBins, 0.0f);
+        scratch->accIm.assign((size_t) kTailBins, 0.0f);
+    }
+
+    const int maxIrLength = (int) std::ceil(kMaxIrSeconds * sampleRate);
+    const int maxTailPartitions = (maxIrLength - kTailStart + kTailSize - 1) / kTailSize;
+
+    for (int ch = 0; ch < kMaxChannels; ++ch)
+    {
+        auto& h = head[(size_t) ch];
+        h.frame.assign((size_t) (2 * kHeadSize), 0.0f);
+        h.currentRe.assign((size_t) kHeadBins, 0.0f);
+        h.currentIm.assign((size_t) kHeadBins, 0.0f);
+        h.pastRe.assign((size_t) kHeadBins, 0.0f);
+        h.pastIm.assign((size_t) kHeadBins, 0.0f);
+        h.history.resize(kHeadPartitions, kHeadBins);
+
+        auto& t = tail[(size_t) ch];
+        t.frame.assign((size_t) (2 * kTailSize), 0.0f);
+        t.history.resize(maxTailPartitions + kTailHeadroom, kTailBins);
+
+        tailInput[(size_t) ch].assign((size_t) kTailSize, 0.0f);
+        for (auto& slot : slots)
+            slot.output[(size_t) ch].assign((size_t) kTailSize, 0.0f);
+    }
+
+    delete pendingIr.exchange(nullptr);
+    delete retiredIr.exchange(nullptr);
+    delete current;
+
+    const float decay = juce::jlimit(kMinIrSeconds, kMaxIrSeconds, decaySeconds);
+    requestedDecay.store(decay, std::memory_order_relaxed);
+    builtDecay = decay;
+    notifiedDecay = decay;
+    current = buildImpulseResponse(decay, false).release();
+
+    clearState();
+    startWorker();
+}
+
+void PartitionedConvolver::reset()
+{
+    if (current == nullptr)
+        return;
+
+    stopWorker();
+    clearState();
+    startWorker();
+}
+
+void PartitionedConvolver::setDecay(float decaySeconds) noexcept
+{
+    const float decay = juce::jlimit(kMinIrSeconds, kMaxIrSeconds, decaySeconds);
+    requestedDecay.store(decay, std::memory_order_relaxed);
+
+    // Called every block with the same value; only wake the worker when a rebuild is due
+    if (std::abs(decay - notifiedDecay) >= kDecayTolerance && worker != nullptr)
+    {
+        notifiedDecay = decay;
+        worker->notify();
+    }
+}
+
+void PartitionedConvolver::clearState() noexcept
+{
+    for (auto& h : head)
+    {
+        std::fill(h.frame.begin(), h.frame.end(), 0.0f);
+        std::fill(h.pastRe.begin(), h.pastRe.end(), 0.0f);
+        std::fill(h.pastIm.begin(), h.pastIm.end(), 0.0f);
+        h.history.clear();
+    }
+
+    for (auto& t : tail)
+    {
+        std::fill(t.frame.begin(), t.frame.end(), 0.0f);
+        t.history.clear();
+    }
+
+    for (auto& slot : slots)
+        for (auto& output : slot.output)
+            std::fill(output.begin(), output.end(), 0.0f);
+
+    headFill = 0;
+    tailFill = 0;
+    headPastStale = true;
+    postedSlot = -1;
+    postedToWorker = false;
+    playingSlot = -1;
+    busyWorkerSlot = -1;
+    jobState.store(jobIdle, std::memory_order_relaxed);
+}
+
+void PartitionedConvolver::startWorker()
+{
+    worker = std::make_unique<Worker>(*this);
+    worker->startThread(juce::Thread::Priority::high);
+}
+
+void PartitionedConvolver::stopWorker()
+{
+    worker.reset();
+}
+
+// -----------------------------------------------------------------------------
+// IR synthesis (prepare and worker)
+// -----------------------------------------------------------------------------
+std::unique_ptr<PartitionedConvolver::ImpulseResponse> PartitionedConvolver::buildImpulseResponse(float decaySeconds, bool serviceJobs)
+{
+    auto ir = std::make_unique<ImpulseResponse>();
+    ir->decaySeconds = decaySeconds;
+
+    // Exponentially decaying noise reaching -60 dB at the end, normalised to unit energy
+    const int length = juce::jmax(1, juce::roundToInt(decaySeconds * sampleRate));
+    std::vector<float> samples((size_t) length);
+    juce::Random rng(12345);
+    const float decayCoeff = std::pow(0.001f, 1.0f / (float) length);
+    float env = 1.0f;
+    double energy = 0.0;
+    for (auto& s : samples)
+    {
+        s = (rng.nextFloat() * 2.0f - 1.0f) * env;
+        energy += (double) s * s;
+        env *= decayCoeff;
+    }
+    juce::FloatVectorOperations::multiply(samples.data(), (float) (1.0 / std::sqrt(juce::jmax(energy, 1.0e-12))), length);
+
+    ir->numTailPartitions = juce::jmax(0, (length - kTailStart + kTailSize - 1) / kTailSize);
+    ir->headRe.assign((size_t) (kHeadPartitions * kHeadBins), 0.0f);
+    ir->headIm.assign((size_t) (kHeadPartitions * kHeadBins), 0.0f);
+    ir->tailRe.assign((size_t) (ir->numTailPartitions * kTailBins), 0.0f);
+    ir->tailIm.assign((size_t) (ir->numTailPartitions * kTailBins), 0.0f);
+
+    // Each partition is zero-padded to twice its size for overlap-save
+    const auto transform = [&] (juce::dsp::FFT& fft, int partitionSize, int offset, float* re, float* im)
+    {
+        std::fill(buildBuffer.begin(), buildBuffer.begin() + 4 * partitionSize, 0.0f);
+        const int count = juce::jlimit(0, partitionSize, length - offset);
+        std::copy(samples.data() + offset, samples.data() + offset + count, buildBuffer.data());
+        fft.performRealOnlyForwardTransform(buildBuffer.data(), true);
+        deinterleave(buildBuffer.data(), re, im, partitionSize + 1);
+    };
+
+    for (int p = 0; p < kHeadPartitions; ++p)
+        transform(buildHeadFft, kHeadSize, p * kHeadSize,
+                  ir->headRe.data() + p * kHeadBins, ir->headIm.data() + p * kHeadBins);
+
+    for (int p = 0; p < ir->numTailPartitions; ++p)
+    {
+        transform(buildTailFft, kTailSize, kTailStart + p * kTailSize,
+                  ir->tailRe.data() + p * kTailBins, ir->tailIm.data() + p * kTailBins);
+
+        // A long build must not hold up the tail job that is due
+        if (serviceJobs)
+            runPendingJob();
+    }
+
+    return ir;
+}
+
+void PartitionedConvolver::rebuildIfNeeded()
+{
+    delete retiredIr.exchange(nullptr, std::memory_order_acquire);
+
+    const float wanted = requestedDecay.load(std::memory_order_relaxed);
+    if (std::abs(wanted - builtDecay) < kDecayTolerance)
+        return;
+
+    auto ir = buildImpulseResponse(wanted, true);
+    builtDecay = wanted;
+
+    // An IR the audio thread never picked up is simply replaced
+    delete pendingIr.exchange(ir.release(), std::memory_order_acq_rel);
+}
+
+// -----------------------------------------------------------------------------
+// Tail (worker, or audio thread when late)
+// -----------------------------------------------------------------------------
+void PartitionedConvolver::runPendingJob()
+{
+    int expected = jobPending;
+    if (! jobState.compare_exchange_strong(expected, jobRunning, std::memory_order_acquire))
+        return;
+
+    runTailJob(slots[(size_t) jobSlot.load(std::memory_order_relaxed)], workerScratch);
+    jobState.store(jobDone, std::memory_order_release);
+}
+
+// Only reads the history, so the audio thread can run a job the worker is still busy with.
+void PartitionedConvolver::runTailJob(TailSlot& slot, TailScratch& scratch) noexcept
+{
+    const auto& ir = *slot.ir;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const auto& history = tail[(size_t) ch].history;
+
+        std::fill(scratch.accRe.begin(), scratch.accRe.end(), 0.0f);
+        std::fill(scratch.accIm.begin(), scratch.accIm.end(), 0.0f);
+        for (int p = 0; p < ir.numTailPartitions; ++p)
+        {
+            const int offset = ((slot.newest + history.numPartitions - p) % history.numPartitions) * kTailBins;
+            multiplyAccumulate(scratch.accRe.data(), scratch.accIm.data(),
+                               history.re.data() + offset, history.im.data() + offset,
+                               ir.tailRe.data() + p * kTailBins, ir.tailIm.data() + p * kTailBins, kTailBins);
+        }
+
+        interleave(scratch.accRe.data(), scratch.accIm.data(), scratch.buffer.data(), kTailBins);
+        mirrorSpectrum(scratch.buffer.data(), 2 * kTailSize);
+        scratch.fft.performRealOnlyInverseTransform(scratch.buffer.data());
+        std::copy(scratch.buffer.begin() + kTailSize, scratch.buffer.begin() + 2 * kTailSize, slot.output[(size_t) ch].begin());
+    }
+}
+
+// Returns the slot holding the output of the job that is due now. Never waits for the worker:
+// a job it has not finished is run here, into a spare slot if the worker is still writing its own.
+int PartitionedConvolver::collectTailJob() noexcept
+{
+    if (postedToWorker)
+    {
+        int expected = jobPending;
+        if (jobState.compare_exchange_strong(expected, jobIdle, std::memory_order_acquire))
+        {
+            lateTailJobs.fetch_add(1, std::memory_order_relaxed);
+            runTailJob(slots[(size_t) postedSlot], audioScratch);
+            return postedSlot;
+        }
+
+        if (expected == jobDone)
+        {
+            jobState.store(jobIdle, std::memory_order_relaxed);
+            return postedSlot;
+        }
+
+        // Still running: the worker keeps its slot until it reports done, and its result is dropped
+        busyWorkerSlot = postedSlot;
+        const int spare = (postedSlot + 1) % (int) slots.size();
+        slots[(size_t) spare].ir = slots[(size_t) postedSlot].ir;
+        slots[(size_t) spare].newest = slots[(size_t) postedSlot].newest;
+        lateTailJobs.fetch_add(1, std::memory_order_relaxed);
+        runTailJob(slots[(size_t) spare], audioScratch);
+        return spare;
+    }
+
+    lateTailJobs.fetch_add(1, std::memory_order_relaxed);
+    runTailJob(slots[(size_t) postedSlot], audioScratch);
+    return postedSlot;
+}
+
+// -----------------------------------------------------------------------------
+// Audio thread
+// -----------------------------------------------------------------------------
+void PartitionedConvolver::updateHeadPast() noexcept
+{
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto& h = head[(size_t) ch];
+        std::fill(h.pastRe.begin(), h.pastRe.end(), 0.0f);
+        std::fill(h.pastIm.begin(), h.pastIm.end(), 0.0f);
+
+        // Partition p meets the block completed p blocks ago (history age p - 1)
+        for (int p = 1; p < kHeadPartitions; ++p)
+        {
+            const int offset = h.history.slot(p - 1) * kHeadBins;
+            multiplyAccumulate(h.pastRe.data(), h.pastIm.data(),
+                               h.history.re.data() + offset, h.history.im.data() + offset,
+                               current->headRe.data() + p * kHeadBins, current->headIm.data() + p * kHeadBins, kHeadBins);
+        }
+    }
+
+    headPastStale = false;
+}
+
+// Transforms the partly filled block, so the new samples are heard without waiting for kHeadSize.
+void PartitionedConvolver::processHead(int channel, const float* input, float* output, int numSamples) noexcept
+{
+    auto& h = head[(size_t) channel];
+
+    std::copy(input, input + numSamples, h.frame.begin() + kHeadSize + headFill);
+    std::copy(h.frame.begin(), h.frame.end(), headBuffer.begin());
+    std::fill(headBuffer.begin() + 2 * kHeadSize, headBuffer.end(), 0.0f);
+    headFft.performRealOnlyForwardTransform(headBuffer.data(), true);
+    deinterleave(headBuffer.data(), h.currentRe.data(), h.currentIm.data(), kHeadBins);
+
+    for (int k = 0; k < kHeadBins; ++k)
+    {
+        const float xr = h.currentRe[(size_t) k], xi = h.currentIm[(size_t) k];
+        const float hr = current->headRe[(size_t) k], hi = current->headIm[(size_t) k];
+        headBuffer[(size_t) (2 * k)] = h.pastRe[(size_t) k] + xr * hr - xi * hi;
+        headBuffer[(size_t) (2 * k + 1)] = h.pastIm[(size_t) k] + xr * hi + xi * hr;
+    }
+
+    mirrorSpectrum(headBuffer.data(), 2 * kHeadSize);
+    headFft.performRealOnlyInverseTransform(headBuffer.data());
+    std::copy(headBuffer.begin() + kHeadSize + headFill, headBuffer.begin() + kHeadSize + headFill + numSamples, output);
+}
+
+void PartitionedConvolver::finishHeadBlock() noexcept
+{
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto& h = head[(size_t) ch];
+        h.history.push(h.currentRe.data(), h.currentIm.data());
+        std::copy(h.frame.begin() + kHeadSize, h.frame.end(), h.frame.begin());
+        std::fill(h.frame.begin() + kHeadSize, h.frame.end(), 0.0f);
+    }
+
+    headFill = 0;
+    headPastStale = true;
+}
+
+// Transforms the block just completed into the tail history.
+void PartitionedConvolver::pushTailBlock() noexcept
+{
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto& t = tail[(size_t) ch];
+        auto& buffer = audioScratch.buffer;
+
+        std::copy(tailInput[(size_t) ch].begin(), tailInput[(size_t) ch].end(), t.frame.begin() + kTailSize);
+        std::copy(t.frame.begin(), t.frame.end(), buffer.begin());
+        std::fill(buffer.begin() + 2 * kTailSize, buffer.end(), 0.0f);
+        audioScratch.fft.performRealOnlyForwardTransform(buffer.data(), true);
+
+        deinterleave(buffer.data(), audioScratch.accRe.data(), audioScratch.accIm.data(), kTailBins);
+        t.history.push(audioScratch.accRe.data(), audioScratch.accIm.data());
+
+        std::copy(t.frame.begin() + kTailSize, t.frame.end(), t.frame.begin());
+    }
+}
+
+// Hands the newest block to the worker, unless it is still finishing a job taken over from it.
+void PartitionedConvolver::postTailJob() noexcept
+{
+    if (busyWorkerSlot >= 0)
+    {
+        if (jobState.load(std::memory_order_acquire) != jobDone)
+            return;
+
+        jobState.store(jobIdle, std::memory_order_relaxed);
+        busyWorkerSlot = -1;
+    }
+
+    jobSlot.store(postedSlot, std::memory_order_relaxed);
+    jobState.store(jobPending, std::memory_order_release);
+    postedToWorker = true;
+    worker->notify();
+}
+
+// The job posted one tail block ago is due now; the block just completed becomes the next job.
+void PartitionedConvolver::finishTailBlock() noexcept
+{
+    tailFill = 0;
+
+    if (postedSlot >= 0)
+        playingSlot = collectTailJob();
+
+    // Nothing the audio thread still has to run refers to the current IR now, so a rebuilt one can
+    // replace it. A job the worker is still finishing may; it frees retired IRs only between jobs.
+    if (retiredIr.load(std::memory_order_acquire) == nullptr)
+    {
+        if (auto* next = pendingIr.exchange(nullptr, std::memory_order_acq_rel))
+        {
+            retiredIr.store(current, std::memory_order_release);
+            current = next;
+            headPastStale = true;
+        }
+    }
+
+    pushTailBlock();
+
+    // Three slots: one playing, one the worker may still be writing, one for the new job
+    int slotIndex = 0;
+    while (slotIndex == playingSlot || slotIndex == busyWorkerSlot)
+        ++slotIndex;
+
+    auto& slot = slots[(size_t) slotIndex];
+    slot.ir = current;
+    slot.newest = tail[0].history.newest;
+
+    postedSlot = slotIndex;
+    postedToWorker = false;
+    postTailJob();
+}
+
+void PartitionedConvolver::process(juce::AudioBuffer<float>& buffer) noexcept
+{
+    const int channels = juce::jmin(buffer.getNumChannels(), numChannels);
+    const int numSamples = buffer.getNumSamples();
+    if (channels <= 0 || current == nullptr)
+        return;
+
+    // Head and tail boundaries coincide (kTailSize is a multiple of kHeadSize), so runs stop at head blocks
+    for (int pos = 0; pos < numSamples;)
+    {
+        const int run = juce::jmin(numSamples - pos, kHeadSize - headFill);
+
+        if (headPastStale)
+            updateHeadPast();
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            float* data = buffer.getWritePointer(ch, pos);
+            std::copy(data, data + run, tailInput[(size_t) ch].begin() + tailFill);
+            processHead(ch, data, data, run);
+
+            if (playingSlot >= 0)
+                juce::FloatVectorOperations::add(data, slots[(size_t) playingSlot].output[(size_t) ch].data() + tailFill, run);
+        }
+
+        pos += run;
+        headFill += run;
+        tailFill += run;
+
+        if (headFill == kHeadSize)
+            finishHeadBlock();
+        if (tailFill == kTailSize)
+            finishTailBlock();
+    }
+
+    for (int ch = channels; ch < buffer.getNumChannels(); ++ch)
+        buffer.clear(ch, 0, numSamples);
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// =============================================================================
+// PartitionedConvolver - zero-latency convolution reverb with a background tail
+//
+// The impulse response is split in two. The first kTailStart samples (the head)
+// are convolved on the audio thread with kHeadSize partitions. Each call
+// transforms the partly filled block, so there is no added latency. The rest
+// (the tail) uses kTailSize partitions. The audio thread transforms each
+// completed kTailSize input block into the tail history; the multiply-accumulate
+// over the history and the inverse transform run as a job on a worker thread.
+// A job's output is not needed until kTailStart - kTailSize samples after it is
+// posted, and jobs are handed over at fixed block boundaries. So the result
+// never depends on thread timing. If the worker has not finished a job by its
+// deadline, the audio thread runs it itself instead of waiting, into a spare
+// slot when the worker is still busy with it.
+//
+// The IR is synthesised (decaying noise, kMaxIrSeconds at most) and transformed
+// on the worker whenever the decay changes. The audio thread swaps it in at the
+// next tail boundary. prepare() builds the first one synchronously. The worker
+// sleeps until a job is posted or the decay changes, so it is idle while
+// process() is not being called. prepare() and reset() park the worker and must
+// not run concurrently with process().
+// =============================================================================
+class PartitionedConvolver
+{
+public:
+    static constexpr int kMaxChannels = 2;
+    static constexpr int kHeadOrder = 7;
+    static constexpr int kHeadSize = 1 << kHeadOrder;   // audio-thread partition
+    static constexpr int kTailOrder = 10;
+    static constexpr int kTailSize = 1 << kTailOrder;   // worker partition
+    static constexpr int kTailStart = 2 * kTailSize;    // IR offset the worker takes over from
+    static constexpr float kMaxIrSeconds = 6.0f;
+
+    PartitionedConvolver();
+    ~PartitionedConvolver();
+
+    void prepare(double sampleRate, int numChannels, float decaySeconds);
+    void reset();
+
+    // Audio thread: asks for an IR with this -60 dB decay time; heard from the next tail boundary after it is built.
+    void setDecay(float decaySeconds) noexcept;
+
+    // In place, wet only; uses at most the number of channels given to prepare().
+    void process(juce::AudioBuffer<float>& buffer) noexcept;
+
+    // Tail jobs the audio thread had to run because the worker had not finished them.
+    int getNumLateTailJobs() const noexcept { return lateTailJobs.load(std::memory_order_relaxed); }
+
+private:
+    class Worker;
+
+    static constexpr int kHeadBins = kHeadSize + 1;
+    static constexpr int kTailBins = kTailSize + 1;
+    static constexpr int kHeadPartitions = kTailStart / kHeadSize;
+    // History partitions beyond the longest IR: blocks that can be pushed while the worker is still
+    // finishing a job the audio thread took over. Later pushes may overwrite what it reads, but its
+    // output is dropped then anyway.
+    static constexpr int kTailHeadroom = 2;
+
+    // Partition spectra, split into real and imaginary planes so the multiply-accumulates vectorise
+    struct ImpulseResponse
+    {
+        float decaySeconds = 0.0f;
+        int numTailPartitions = 0;
+        std::vector<float> headRe, headIm; // kHeadPartitions x kHeadBins
+        std::vector<float> tailRe, tailIm; // numTailPartitions x kTailBins
+    };
+
+    // Frequency-domain delay line: spectra of the most recent input blocks, age 0 the newest
+    struct SpectrumHistory
+    {
+        void resize(int numPartitions, int numBins);
+        void clear() noexcept;
+        void push(const float* re, const float* im) noexcept;
+        int slot(int age) const noexcept { return (newest + numPartitions - age) % numPartitions; }
+
+        std::vector<float> re, im;
+        int numPartitions = 0;
+        int numBins = 0;
+        int newest = 0;
+    };
+
+    struct HeadChannel
+    {
+        std::vector<float> frame;   // previous block | current block (zero past the fill point)
+        std::vector<float> currentRe, currentIm;
+        std::vector<float> pastRe, pastIm; // sum over partitions 1.. for the current block
+        SpectrumHistory history;
+    };
+
+    struct TailChannel
+    {
+        std::vector<float> frame; // previous block | current block
+        SpectrumHistory history;  // read-only to jobs; kTailHeadroom spare partitions
+    };
+
+    // A tail job and its output: posted when its input completes, collected one block later
+    struct TailSlot
+    {
+        std::array<std::vector<float>, kMaxChannels> output;
+        const ImpulseResponse* ir = nullptr;
+        int newest = 0; // history slot holding the job's input block
+    };
+
+    struct TailScratch
+    {
+        juce::dsp::FFT fft { kTailOrder + 1 };
+        std::vector<float> buffer;
+        std::vector<float> accRe, accIm;
+    };
+
+    enum JobState
+    {
+        jobIdle,
+        jobPending,
+        jobRunning,
+        jobDone
+    };
+
+    std::unique_ptr<ImpulseResponse> buildImpulseResponse(float decaySeconds, bool serviceJobs);
+    void rebuildIfNeeded();
+    void runPendingJob();
+    void runTailJob(TailSlot& slot, TailScratch& scratch) noexcept;
+    int collectTailJob() noexcept;
+    void pushTailBlock() noexcept;
+    void postTailJob() noexcept;
+    void finishHeadBlock() noexcept;
+    void finishTailBlock() noexcept;
+    void updateHeadPast() noexcept;
+    void processHead(int channel, const float* input, float* output, int numSamples) noexcept;
+    void clearState() noexcept;
+    void stopWorker();
+    void startWorker();
+
+    double sampleRate = 44100.0;
+    int numChannels = 0;
+
+    // Audio thread
+    std::array<HeadChannel, kMaxChannels> head;
+    juce::dsp::FFT headFft { kHeadOrder + 1 };
+    std::vector<float> headBuffer;
+    int headFill = 0;
+    bool headPastStale = true;
+
+    std::array<std::vector<float>, kMaxChannels> tailInput;
+    std::array<TailChannel, kMaxChannels> tail;
+    TailScratch audioScratch;
+    int tailFill = 0;
+    std::array<TailSlot, 3> slots;
+    int postedSlot = -1;      // job to collect at the next tail boundary
+    bool postedToWorker = false;
+    int playingSlot = -1;     // output being mixed in
+    int busyWorkerSlot = -1;  // slot the worker is still writing for a job the audio thread took over
+    float notifiedDecay = 0.0f;
+    ImpulseResponse* current = nullptr;
+
+    // Audio -> worker job handoff
+    std::atomic<int> jobSlot { 0 };
+    std::atomic<int> jobState { jobIdle };
+    std::atomic<int> lateTailJobs { 0 };
+    TailScratch workerScratch;
+
+    // IR handoff: worker -> audio (pending), audio -> worker (retired)
+    std::atomic<float> requestedDecay { 1.0f };
+    float builtDecay = 0.0f; // worker only after prepare()
+    std::atomic<ImpulseResponse*> pendingIr { nullptr };
+    std::atomic<ImpulseResponse*> retiredIr { nullptr };
+
+    // IR builder scratch (worker / prepare only)
+    juce::dsp::FFT buildHeadFft { kHeadOrder + 1 };
+    juce::dsp::FFT buildTailFft { kTailOrder + 1 };
+    std::vector<float> buildBuffer;
+
+    std::unique_ptr<Worker> worker;
+
+    JUCE_DECLARE_NON_COPYABLE(PartitionedConvolver)
+};
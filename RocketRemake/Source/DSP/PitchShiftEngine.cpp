@@ -0,0 +1,263 @@
+#include "PitchShiftEngine.h"
+
+namespace
+{
+    constexpr int kMaxChannels = 2;
+
+    inline float hermite(float xm1, float x0, float x1, float x2, float t) noexcept
+    {
+        const float c1 = 0.5f * (x1 - xm1);
+        const float c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+        const float c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+        return ((c3 * t + c2) * t + c1) * t + x0;
+    }
+}
+
+PitchShiftEngine::ModeSettings PitchShiftEngine::getSettings(Mode m) noexcept
+{
+    switch (m)
+    {
+        case Mode::lowLatency:  return { 10.0f, 2.0f, false };
+        case Mode::highQuality: return { 60.0f, 8.0f, true };
+        case Mode::balanced:
+        default:                return { 30.0f, 4.0f, false };
+    }
+}
+
+void PitchShiftEngine::prepare(double newSampleRate, int newNumChannels)
+{
+    sampleRate = newSampleRate;
+    numChannels = juce::jlimit(1, kMaxChannels, newNumChannels);
+
+    for (int i = 0; i <= kWindowSize; ++i)
+    {
+        const float s = std::sin(juce::MathConstants<float>::pi * (float) i / (float) kWindowSize);
+        window[(size_t) i] = s * s;
+    }
+
+    // Room for the largest mode's sweep, search and correlation window, plus the interpolation taps
+    const auto largest = getSettings(Mode::highQuality);
+    const int maxGrain = (int) std::ceil(largest.grainMs * 0.001 * sampleRate);
+    const int maxSearch = (int) std::ceil(largest.searchMs * 0.001 * sampleRate);
+    const int needed = kMinDelay + maxGrain + 2 * maxSearch + kCorrelationLength + 4;
+
+    const int ringSize = juce::nextPowerOfTwo(needed);
+    ring.setSize(numChannels, ringSize);
+    ringMask = ringSize - 1;
+    searchHistory.assign((size_t) (2 * maxSearch + kCorrelationLength + 1), 0.0f);
+
+    updateGeometry();
+    reset();
+}
+
+void PitchShiftEngine::reset() noexcept
+{
+    ring.clear();
+    writePos = 0;
+
+    const float base = (float) (kMinDelay + searchRange + (sweep < 0.0f ? grainLength : 0));
+    phase = { 0.0f, 0.5f };
+    startDelay = { base, base };
+}
+
+int PitchShiftEngine::getMaxLatencySamples() const noexcept
+{
+    const auto largest = getSettings(Mode::highQuality);
+    return kMinDelay + juce::roundToInt(largest.searchMs * 0.001 * sampleRate)
+         + juce::roundToInt(largest.grainMs * 0.001 * sampleRate) / 2;
+}
+
+void PitchShiftEngine::setMode(Mode newMode) noexcept
+{
+    if (newMode == mode)
+        return;
+
+    mode = newMode;
+    updateGeometry();
+
+    phase = { 0.0f, 0.5f };
+    const float base = (float) (kMinDelay + searchRange + (sweep < 0.0f ? grainLength : 0));
+    startDelay = { base, base };
+}
+
+void PitchShiftEngine::setSemitones(float semitones) noexcept
+{
+    const float newRatio = std::pow(2.0f, juce::jlimit(-24.0f, 24.0f, semitones) / 12.0f);
+    if (newRatio == ratio)
+        return;
+
+    const float oldSweep = sweep;
+    ratio = newRatio;
+    updateGeometry();
+
+    // Keep each head where it is when the sweep direction flips
+    if (sweep != oldSweep)
+        for (size_t g = 0; g < 2; ++g)
+            startDelay[g] += (oldSweep - sweep) * phase[g];
+}
+
+void PitchShiftEngine::updateGeometry() noexcept
+{
+    const auto settings = getSettings(mode);
+    grainLength = juce::jmax(64, juce::roundToInt(settings.grainMs * 0.001 * sampleRate));
+    searchRange = juce::roundToInt(settings.searchMs * 0.001 * sampleRate);
+    cubic = settings.cubic;
+    latencySamples = kMinDelay + searchRange + grainLength / 2;
+
+    phaseIncrement = std::abs(1.0f - ratio) / (float) grainLength;
+    sweep = ratio < 1.0f ? (float) grainLength : -(float) grainLength;
+}
+
+// Delay within +-searchRange of candidateBase whose recent history best matches the history
+// behind referenceDelay (the grain that is fully faded in right now). A coarse pass tries every
+// kCoarseSearchStep-th offset, then the neighbourhood of the winner is searched sample by sample.
+int PitchShiftEngine::findAlignment(int candidateBase, int referenceDelay) noexcept
+{
+    const auto* left = ring.getReadPointer(0);
+    const auto* right = ring.getReadPointer(juce::jmin(1, numChannels - 1));
+
+    const auto mono = [&](int delay) noexcept
+    {
+        const int index = (writePos - delay) & ringMask;
+        return left[index] + right[index];
+    };
+
+    // Unwrap both regions once so the correlations below are plain dot products.
+    // searchHistory[j] holds the sample at delay (candidateBase - searchRange + j).
+    const int firstDelay = candidateBase - searchRange;
+    const int span = 2 * searchRange + kCorrelationLength;
+    for (int j = 0; j < span; ++j)
+        searchHistory[(size_t) j] = mono(firstDelay + j);
+    for (int k = 0; k < kCorrelationLength; ++k)
+        referenceHistory[(size_t) k] = mono(referenceDelay + k);
+
+    const auto score = [this](int offsetIndex) noexcept
+    {
+        const float* candidate = searchHistory.data() + offsetIndex;
+        float sum = 0.0f;
+        for (int k = 0; k < kCorrelationLength; ++k)
+            sum += candidate[k] * referenceHistory[(size_t) k];
+        return sum;
+    };
+
+    const int lastIndex = 2 * searchRange;
+    int bestIndex = searchRange;
+    float bestScore = -std::numeric_limits<float>::max();
+
+    const auto consider = [&](int offsetIndex)
+    {
+        const float s = score(offsetIndex);
+        if (s > bestScore)
+        {
+            bestScore = s;
+            bestIndex = offsetIndex;
+        }
+    };
+
+    for (int j = 0; j <= lastIndex; j += kCoarseSearchStep)
+        consider(j);
+
+    const int coarseBest = bestIndex;
+    for (int j = juce::jmax(0, coarseBest - kCoarseSearchStep + 1); j <= juce::jmin(lastIndex, coarseBest + kCoarseSearchStep - 1); ++j)
+        if (j != coarseBest)
+            consider(j);
+
+    return firstDelay + bestIndex;
+}
+
+void PitchShiftEngine::restartGrain(int grain) noexcept
+{
+    const int base = kMinDelay + searchRange + (sweep < 0.0f ? grainLength : 0);
+
+    if (searchRange > 0)
+    {
+        const size_t other = (size_t) (1 - grain);
+        const int referenceDelay = juce::roundToInt(startDelay[other] + sweep * phase[other]);
+        startDelay[(size_t) grain] = (float) findAlignment(base, referenceDelay);
+    }
+    else
+    {
+        startDelay[(size_t) grain] = (float) base;
+    }
+}
+
+void PitchShiftEngine::process(juce::AudioBuffer<float>& buffer) noexcept
+{
+    const int channels = juce::jmin(buffer.getNumChannels(), numChannels);
+    if (channels <= 0 || ring.getNumSamples() == 0)
+        return;
+
+    if (cubic)
+        processFrames<true>(buffer, channels);
+    else
+        processFrames<false>(buffer, channels);
+}
+
+template <bool Cubic>
+void PitchShiftEngine::processFrames(juce::AudioBuffer<float>& buffer, int channels) noexcept
+{
+    std::array<float*, kMaxChannels> io {};
+    std::array<float*, kMaxChannels> history {};
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        io[(size_t) ch] = buffer.getWritePointer(ch);
+        history[(size_t) ch] = ring.getWritePointer(ch);
+    }
+
+    const float minDelay = (float) kMinDelay;
+    const float maxDelay = (float) (kMinDelay + grainLength + 2 * searchRange);
+    const int numSamples = buffer.getNumSamples();
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        for (int ch = 0; ch < channels; ++ch)
+            history[(size_t) ch][writePos] = io[(size_t) ch][i];
+
+        // Per-frame head geometry, shared by every channel
+        std::array<float, 2> weight, frac;
+        std::array<int, 2> index;
+        for (size_t g = 0; g < 2; ++g)
+        {
+            weight[g] = window[(size_t) (phase[g] * (float) kWindowSize)];
+
+            const float delay = juce::jlimit(minDelay, maxDelay, startDelay[g] + sweep * phase[g]);
+            const int whole = (int) delay;
+            index[g] = writePos - whole - 1;       // sample just before the read position
+            frac[g] = 1.0f - (delay - (float) whole);
+        }
+
+        const int dryIndex = (writePos - latencySamples) & ringMask;
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            const float* h = history[(size_t) ch];
+            float wet = 0.0f;
+
+            for (size_t g = 0; g < 2; ++g)
+            {
+                const float x0 = h[index[g] & ringMask];
+                const float x1 = h[(index[g] + 1) & ringMask];
+
+                if constexpr (Cubic)
+                    wet += weight[g] * hermite(h[(index[g] - 1) & ringMask], x0, x1, h[(index[g] + 2) & ringMask], frac[g]);
+                else
+                    wet += weight[g] * (x0 + frac[g] * (x1 - x0));
+            }
+
+            const float dry = h[dryIndex];
+            io[(size_t) ch][i] = dry + mix * (wet - dry);
+        }
+
+        for (size_t g = 0; g < 2; ++g)
+        {
+            phase[g] += phaseIncrement;
+            if (phase[g] >= 1.0f)
+            {
+                phase[g] -= 1.0f;
+                restartGrain((int) g);
+            }
+        }
+
+        writePos = (writePos + 1) & ringMask;
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+
+// =============================================================================
+// PitchShiftEngine - two-grain delay-line pitch shifter with WSOLA grain alignment
+//
+// Two read heads sweep a shared ring buffer at the pitch ratio, each across one
+// grain length, half a grain apart, with sin^2 crossfades that sum to one. When
+// a grain restarts, its start is moved by up to the mode's search range to the
+// offset that best correlates with the grain still playing. This removes most
+// of the phasing/chorusing of a plain two-tap shifter. All channels share the
+// read heads, so the stereo image stays intact and per-channel cost is just
+// two interpolated reads.
+//
+// Latency is constant for a given mode and sample rate: dry and wet are both
+// taken from the ring, so the stage delays everything by getLatencySamples(),
+// even at 0 semitones. prepare() sizes the ring for the largest mode, so
+// setMode() never allocates.
+// =============================================================================
+class PitchShiftEngine
+{
+public:
+    enum class Mode
+    {
+        lowLatency,  // 10 ms grains, +-2 ms search, linear interpolation
+        balanced,    // 30 ms grains, +-4 ms search, linear interpolation
+        highQuality  // 60 ms grains, +-8 ms search, cubic interpolation
+    };
+
+    void prepare(double sampleRate, int numChannels);
+    void reset() noexcept;
+
+    // Audio thread. Changing mode restarts the grains.
+    void setMode(Mode newMode) noexcept;
+    void setSemitones(float semitones) noexcept;
+    void setMix(float newMix) noexcept { mix = juce::jlimit(0.0f, 1.0f, newMix); }
+
+    Mode getMode() const noexcept { return mode; }
+    int getLatencySamples() const noexcept { return latencySamples; }
+
+    // Largest latency any mode can report at the prepared sample rate.
+    int getMaxLatencySamples() const noexcept;
+
+    // In place; uses at most the number of channels given to prepare().
+    void process(juce::AudioBuffer<float>& buffer) noexcept;
+
+private:
+    struct ModeSettings
+    {
+        float grainMs;
+        float searchMs;
+        bool cubic;
+    };
+
+    static ModeSettings getSettings(Mode m) noexcept;
+
+    static constexpr int kMinDelay = 4;          // keeps interpolation taps behind the write head
+    static constexpr int kCorrelationLength = 256;
+    static constexpr int kCoarseSearchStep = 4;  // offsets tried in the first pass; the best is refined to one sample
+    static constexpr int kWindowSize = 1024;
+
+    template <bool Cubic>
+    void processFrames(juce::AudioBuffer<float>& buffer, int numChannels) noexcept;
+
+    void restartGrain(int grain) noexcept;
+    int findAlignment(int candidateBase, int referenceDelay) noexcept;
+    void updateGeometry() noexcept;
+
+    double sampleRate = 44100.0;
+    int numChannels = 0;
+
+    juce::AudioBuffer<float> ring;
+    int ringMask = 0;
+    int writePos = 0;
+
+    std::array<float, kWindowSize + 1> window {}; // sin^2 over one grain
+
+    // Mono history around the alignment candidates and behind the reference head, filled per search
+    std::vector<float> searchHistory;
+    std::array<float, kCorrelationLength> referenceHistory {};
+
+    Mode mode = Mode::balanced;
+    float ratio = 1.0f;
+    float mix = 1.0f;
+
+    int grainLength = 0;    // samples the delay sweeps across per grain
+    int searchRange = 0;    // +- samples for alignment
+    int latencySamples = 0;
+    bool cubic = false;
+
+    float phaseIncrement = 0.0f; // |1 - ratio| / grainLength
+    float sweep = 0.0f;          // delay change over a grain: +grainLength going down, -grainLength going up
+
+    std::array<float, 2> phase {};      // 0..1 through each grain
+    std::array<float, 2> startDelay {}; // delay at phase 0, alignment included
+};
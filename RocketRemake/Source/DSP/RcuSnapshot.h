@@ -0,0 +1,101 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// =============================================================================
+// RcuSnapshot - immutable state published to the audio thread
+//
+// Writers build a fresh T and publish() it with a single atomic pointer swap.
+// The audio thread reads through a ReadScope, which pins the snapshot it saw so
+// the writer never frees it underneath. Retired snapshots are deleted by the
+// writer (on a later publish(), reclaim() or destruction), never by the reader.
+//
+// One reader thread (the audio callback) is supported. Writer-side calls
+// (publish, reclaim, getLatest) must be serialised by the caller.
+// =============================================================================
+template <typename T>
+class RcuSnapshot
+{
+public:
+    RcuSnapshot() : RcuSnapshot(std::make_unique<T>()) {}
+
+    explicit RcuSnapshot(std::unique_ptr<T> initial)
+        : current(initial.release())
+    {
+        jassert(current.load() != nullptr);
+    }
+
+    ~RcuSnapshot()
+    {
+        jassert(inUse.load() == nullptr);
+        delete current.load();
+    }
+
+    // Audio thread: pins the current snapshot until release() or the next acquire().
+    const T* acquire() noexcept
+    {
+        // Hazard-pointer handshake: publish what we are about to use, then confirm it is
+        // still current. If a writer swapped in between, it may already be retiring it.
+        auto* p = current.load(std::memory_order_seq_cst);
+        for (;;)
+        {
+            inUse.store(p, std::memory_order_seq_cst);
+            auto* confirmed = current.load(std::memory_order_seq_cst);
+            if (confirmed == p)
+                return p;
+            p = confirmed;
+        }
+    }
+
+    // Audio thread: drops the pin taken by acquire().
+    void release() noexcept { inUse.store(nullptr, std::memory_order_release); }
+
+    // Audio thread: pins the current snapshot for the lifetime of the scope.
+    class ReadScope
+    {
+    public:
+        explicit ReadScope(RcuSnapshot& owner) noexcept : rcu(owner), snapshot(owner.acquire()) {}
+        ~ReadScope() noexcept { rcu.release(); }
+
+        const T& operator*() const noexcept { return *snapshot; }
+        const T* operator->() const noexcept { return snapshot; }
+        const T* get() const noexcept { return snapshot; }
+
+    private:
+        RcuSnapshot& rcu;
+        const T* snapshot = nullptr;
+
+        JUCE_DECLARE_NON_COPYABLE(ReadScope)
+    };
+
+    // Writer: the most recently published snapshot.
+    const T& getLatest() const noexcept { return *current.load(std::memory_order_acquire); }
+
+    // Writer: swaps in a new snapshot and frees any retired ones the reader has let go of.
+    void publish(std::unique_ptr<T> next)
+    {
+        jassert(next != nullptr);
+        retired.emplace_back(current.exchange(next.release(), std::memory_order_seq_cst));
+        reclaim();
+    }
+
+    // Writer: deletes retired snapshots that are not pinned by the reader.
+    void reclaim()
+    {
+        const auto* pinned = inUse.load(std::memory_order_seq_cst);
+        retired.erase(std::remove_if(retired.begin(), retired.end(),
+                                     [pinned] (const std::unique_ptr<T>& p) { return p.get() != pinned; }),
+                      retired.end());
+    }
+
+private:
+    std::atomic<T*> current { nullptr };
+    std::atomic<const T*> inUse { nullptr };
+    std::vector<std::unique_ptr<T>> retired;
+
+    JUCE_DECLARE_NON_COPYABLE(RcuSnapshot)
+};
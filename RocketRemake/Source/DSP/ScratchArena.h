@@ -0,0 +1,88 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+// =============================================================================
+// ScratchArena - preallocated audio buffers lent out on the audio thread
+//
+// prepare() sizes a fixed pool off the audio thread; during process() a Lease
+// borrows one buffer as a non-owning AudioBuffer view, so dry copies and other
+// temporaries never touch the heap. Leases are returned in reverse order when
+// they go out of scope. A request the pool cannot satisfy (more channels or
+// samples than prepared, or every buffer already lent) gets an invalid lease
+// holding an empty buffer; callers check isValid() before using it. Chains
+// keep their blocks within getMaxSamples() so this stays the exception.
+// Audio thread only; not thread-safe.
+// =============================================================================
+class ScratchArena
+{
+public:
+    static constexpr int kDefaultNumBuffers = 2;
+
+    void prepare(int numChannels, int maxSamples, int numBuffers = kDefaultNumBuffers)
+    {
+        pool.clear();
+        for (int i = 0; i < numBuffers; ++i)
+            pool.add(new juce::AudioBuffer<float>(numChannels, maxSamples));
+
+        inUse = 0;
+    }
+
+    int getMaxSamples() const noexcept { return pool.isEmpty() ? 0 : pool.getFirst()->getNumSamples(); }
+
+    class Lease
+    {
+    public:
+        // Borrows a buffer of the given size; contents are left as they were.
+        Lease(ScratchArena& owner, int numChannels, int numSamples) noexcept
+            : arena(owner), view(owner.borrow(numChannels, numSamples)),
+              valid(view.getNumChannels() == numChannels && view.getNumSamples() == numSamples) {}
+
+        // Borrows a buffer shaped like source and copies source into it.
+        Lease(ScratchArena& owner, const juce::AudioBuffer<float>& source) noexcept
+            : Lease(owner, source.getNumChannels(), source.getNumSamples())
+        {
+            if (valid)
+                for (int ch = 0; ch < view.getNumChannels(); ++ch)
+                    view.copyFrom(ch, 0, source, ch, 0, view.getNumSamples());
+        }
+
+        ~Lease() noexcept { --arena.inUse; }
+
+        // False when the pool could not lend a buffer of the requested size; the buffer is then empty.
+        bool isValid() const noexcept { return valid; }
+
+        juce::AudioBuffer<float>& getBuffer() noexcept { return view; }
+        const juce::AudioBuffer<float>& getBuffer() const noexcept { return view; }
+
+    private:
+        ScratchArena& arena;
+        juce::AudioBuffer<float> view;
+        bool valid;
+
+        JUCE_DECLARE_NON_COPYABLE(Lease)
+    };
+
+private:
+    juce::AudioBuffer<float> borrow(int numChannels, int numSamples) noexcept
+    {
+        // Running out means prepare() was given too few buffers or too small a block size
+        jassert(juce::isPositiveAndBelow(inUse, pool.size()));
+        ++inUse;
+
+        if (inUse > pool.size())
+            return juce::AudioBuffer<float>();
+
+        auto& source = *pool.getUnchecked(inUse - 1);
+
+        // Never hand out a shorter buffer than asked for: callers would read past it
+        jassert(numChannels <= source.getNumChannels() && numSamples <= source.getNumSamples());
+        if (numChannels > source.getNumChannels() || numSamples > source.getNumSamples())
+            return juce::AudioBuffer<float>();
+
+        return juce::AudioBuffer<float>(source.getArrayOfWritePointers(), numChannels, numSamples);
+    }
+
+    juce::OwnedArray<juce::AudioBuffer<float>> pool;
+    int inUse = 0;
+};
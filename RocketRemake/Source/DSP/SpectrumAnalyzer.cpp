@@ -0,0 +1,204 @@
+#include "SpectrumAnalyzer.h"
+
+namespace
+{
+    constexpr int kWorkerIntervalMs = 10;
+    constexpr float kFloorDb = -120.0f;
+    constexpr float kReleasePerFrame = 0.25f; // falling bins move this far towards the new value per frame
+}
+
+// =============================================================================
+class SpectrumAnalyzer::Worker : public juce::Thread
+{
+public:
+    explicit Worker(SpectrumAnalyzer& ownerIn) : juce::Thread("Rocket Spectrum"), owner(ownerIn) {}
+    ~Worker() override { stopThread(1000); }
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            owner.processPending();
+            wait(kWorkerIntervalMs);
+        }
+    }
+
+private:
+    SpectrumAnalyzer& owner;
+};
+
+// =============================================================================
+SpectrumAnalyzer::SpectrumAnalyzer()
+    : fftData((size_t) kFftSize * 2, 0.0f)
+{
+    for (auto& state : taps)
+    {
+        state.history.setSize(2, kFftSize);
+        state.history.clear();
+        state.smoothedDb.assign((size_t) kNumBins, kFloorDb);
+        state.publishedDb.assign((size_t) kNumBins, kFloorDb);
+    }
+
+    prepare(sampleRate.load(), 512);
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    worker.reset();
+}
+
+void SpectrumAnalyzer::prepare(double newSampleRate, int maxBlockSize)
+{
+    // prepareToPlay's thread and the editor's timer both get here; the audio thread never does
+    const juce::ScopedLock sl(lifecycleLock);
+
+    // The worker reads the FIFOs being replaced; park it while they are resized
+    const bool wasEnabled = isEnabled();
+    setEnabledLocked(false);
+
+    sampleRate.store(newSampleRate, std::memory_order_relaxed);
+
+    const int capacity = juce::jmax(kFftSize, maxBlockSize * 4, juce::roundToInt(newSampleRate * 0.1));
+
+    for (auto& state : taps)
+    {
+        state.fifo = std::make_unique<juce::AbstractFifo>(capacity);
+        state.fifoStorage.setSize(2, capacity);
+        state.fifoStorage.clear();
+    }
+
+    setEnabledLocked(wasEnabled);
+}
+
+void SpectrumAnalyzer::setEnabled(bool shouldBeEnabled)
+{
+    const juce::ScopedLock sl(lifecycleLock);
+    setEnabledLocked(shouldBeEnabled);
+}
+
+void SpectrumAnalyzer::setEnabledLocked(bool shouldBeEnabled)
+{
+    if (shouldBeEnabled == isEnabled())
+        return;
+
+    if (shouldBeEnabled)
+    {
+        worker = std::make_unique<Worker>(*this);
+        worker->startThread(juce::Thread::Priority::low);
+        enabled.store(true, std::memory_order_release);
+    }
+    else
+    {
+        enabled.store(false, std::memory_order_release);
+        worker.reset();
+    }
+}
+
+void SpectrumAnalyzer::push(Tap tap, const juce::AudioBuffer<float>& buffer) noexcept
+{
+    if (! isEnabled())
+        return;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    auto& state = taps[(size_t) tap];
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = buffer.getNumChannels();
+
+    if (numChannels > 0 && state.fifo->getFreeSpace() >= numSamples)
+    {
+        const auto scope = state.fifo->write(numSamples);
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            const int source = juce::jmin(ch, numChannels - 1);
+            if (scope.blockSize1 > 0)
+                state.fifoStorage.copyFrom(ch, scope.startIndex1, buffer, source, 0, scope.blockSize1);
+            if (scope.blockSize2 > 0)
+                state.fifoStorage.copyFrom(ch, scope.startIndex2, buffer, source, scope.blockSize1, scope.blockSize2);
+        }
+    }
+
+    const double nanos = (double) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    const double average = state.pushCostNanos.load(std::memory_order_relaxed);
+    state.pushCostNanos.store(average + 0.01 * (nanos - average), std::memory_order_relaxed);
+}
+
+double SpectrumAnalyzer::getAudioThreadCostMicros() const noexcept
+{
+    double total = 0.0;
+    for (const auto& state : taps)
+        total += state.pushCostNanos.load(std::memory_order_relaxed);
+    return total * 1.0e-3;
+}
+
+bool SpectrumAnalyzer::getSpectrum(Tap tap, std::vector<float>& magnitudesDb) const
+{
+    const juce::ScopedLock sl(publishLock);
+    const auto& state = taps[(size_t) tap];
+    if (! state.hasFrame)
+        return false;
+
+    magnitudesDb = state.publishedDb;
+    return true;
+}
+
+// Worker thread: moves FIFO contents into the analysis history and runs a frame every hop.
+void SpectrumAnalyzer::processPending()
+{
+    for (auto& state : taps)
+    {
+        const int available = state.fifo->getNumReady();
+        if (available <= 0)
+            continue;
+
+        const auto scope = state.fifo->read(available);
+        const std::array<std::pair<int, int>, 2> ranges { { { scope.startIndex1, scope.blockSize1 },
+                                                            { scope.startIndex2, scope.blockSize2 } } };
+
+        for (const auto& [rangeStart, rangeSize] : ranges)
+        {
+            for (int i = 0; i < rangeSize; ++i)
+            {
+                for (int ch = 0; ch < 2; ++ch)
+                    state.history.setSample(ch, state.historyWritePos, state.fifoStorage.getSample(ch, rangeStart + i));
+
+                state.historyWritePos = (state.historyWritePos + 1) % kFftSize;
+
+                if (++state.samplesSinceFrame >= kHopSize)
+                {
+                    state.samplesSinceFrame = 0;
+                    analyse(state);
+                }
+            }
+        }
+    }
+}
+
+void SpectrumAnalyzer::analyse(TapState& state)
+{
+    // Oldest sample first, mono sum of both channels
+    for (int i = 0; i < kFftSize; ++i)
+    {
+        const int pos = (state.historyWritePos + i) % kFftSize;
+        fftData[(size_t) i] = 0.5f * (state.history.getSample(0, pos) + state.history.getSample(1, pos));
+    }
+    std::fill(fftData.begin() + kFftSize, fftData.end(), 0.0f);
+
+    window.multiplyWithWindowingTable(fftData.data(), (size_t) kFftSize);
+    fft.performFrequencyOnlyForwardTransform(fftData.data(), true);
+
+    // A full-scale sine through a Hann window peaks at kFftSize / 4
+    const float normalise = 4.0f / (float) kFftSize;
+
+    for (int bin = 0; bin < kNumBins; ++bin)
+    {
+        const float db = juce::Decibels::gainToDecibels(fftData[(size_t) bin] * normalise, kFloorDb);
+        auto& smoothed = state.smoothedDb[(size_t) bin];
+        smoothed = db > smoothed ? db : smoothed + kReleasePerFrame * (db - smoothed);
+    }
+
+    const juce::ScopedLock sl(publishLock);
+    state.publishedDb = state.smoothedDb;
+    state.hasFrame = true;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <vector>
+
+// =============================================================================
+// SpectrumAnalyzer - input/output spectra for the developer panel
+//
+// The audio thread only copies samples into a lock-free single-producer FIFO per
+// tap (input before the FX chain, output after it). A background thread drains
+// the FIFOs, runs a Hann-windowed FFT every kHopSize samples, smooths the result
+// in dB and hands finished frames to the UI. Nothing runs while disabled.
+// =============================================================================
+class SpectrumAnalyzer
+{
+public:
+    enum class Tap
+    {
+        input,
+        output
+    };
+
+    static constexpr int kNumTaps = 2;
+    static constexpr int kFftOrder = 11;
+    static constexpr int kFftSize = 1 << kFftOrder;
+    static constexpr int kNumBins = kFftSize / 2 + 1;
+    static constexpr int kHopSize = kFftSize / 4;
+
+    SpectrumAnalyzer();
+    ~SpectrumAnalyzer();
+
+    // Before processing starts; sizes the FIFOs for about 100 ms of audio.
+    void prepare(double sampleRate, int maxBlockSize);
+
+    // Message thread (or prepare's thread): starts or stops the background thread and the audio-thread pushes.
+    void setEnabled(bool shouldBeEnabled);
+    bool isEnabled() const noexcept { return enabled.load(std::memory_order_relaxed); }
+
+    // Audio thread: copies the block into the tap's FIFO (first two channels). Drops the
+    // block if the analyzer thread has fallen behind.
+    void push(Tap tap, const juce::AudioBuffer<float>& buffer) noexcept;
+
+    // Message thread: latest smoothed spectrum of a tap in dBFS, kNumBins values from DC to
+    // Nyquist. Returns false until a frame has been computed.
+    bool getSpectrum(Tap tap, std::vector<float>& magnitudesDb) const;
+
+    double getSampleRate() const noexcept { return sampleRate.load(std::memory_order_relaxed); }
+
+    // Audio-thread time spent in push() per block, summed over both taps (exponential average).
+    double getAudioThreadCostMicros() const noexcept;
+
+private:
+    class Worker;
+
+    struct TapState
+    {
+        // Audio thread -> worker
+        std::unique_ptr<juce::AbstractFifo> fifo;
+        juce::AudioBuffer<float> fifoStorage;
+        std::atomic<double> pushCostNanos { 0.0 };
+
+        // Worker only
+        juce::AudioBuffer<float> history; // last kFftSize samples, circular
+        int historyWritePos = 0;
+        int samplesSinceFrame = 0;
+        std::vector<float> smoothedDb;
+
+        // Worker -> UI, guarded by publishLock
+        std::vector<float> publishedDb;
+        bool hasFrame = false;
+    };
+
+    void setEnabledLocked(bool shouldBeEnabled);
+    void processPending();
+    void analyse(TapState& state);
+
+    std::array<TapState, kNumTaps> taps;
+    std::atomic<bool> enabled { false };
+    std::atomic<double> sampleRate { 44100.0 };
+
+    juce::dsp::FFT fft { kFftOrder };
+    juce::dsp::WindowingFunction<float> window { (size_t) kFftSize, juce::dsp::WindowingFunction<float>::hann, false };
+    std::vector<float> fftData;
+
+    juce::CriticalSection publishLock;   // worker and message thread only
+    juce::CriticalSection lifecycleLock; // worker and FIFO lifetime (prepare/setEnabled); never the audio thread
+    std::unique_ptr<Worker> worker;
+
+    JUCE_DECLARE_NON_COPYABLE(SpectrumAnalyzer)
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+
+#if ! JUCE_USE_SIMD
+ #error "StereoBiquadCascade needs juce::dsp::SIMDRegister (SSE2 or NEON)"
+#endif
+
+// =============================================================================
+// StereoBiquadCascade - NumSections biquads in series, both channels at once
+//
+// Left and right share one SIMDRegister<double> (two lanes), so every section
+// runs once per sample for the pair instead of once per channel. Sections use
+// transposed direct form II with normalised coefficients. The state is kept in
+// double, which also keeps low cutoffs at high sample rates well behaved.
+// Coefficients are only touched by setSection(); nothing allocates.
+// Audio thread only; not thread-safe.
+// =============================================================================
+template <int NumSections>
+class StereoBiquadCascade
+{
+public:
+    // juce::dsp::IIR::ArrayCoefficients order: b0, b1, b2, a0, a1, a2
+    using ArrayCoefficients = std::array<float, 6>;
+
+    StereoBiquadCascade()
+    {
+        for (int i = 0; i < NumSections; ++i)
+            setIdentity(i);
+        reset();
+    }
+
+    void setSection(int index, const ArrayCoefficients& c) noexcept
+    {
+        jassert(juce::isPositiveAndBelow(index, NumSections));
+        auto& s = sections[(size_t) index];
+        const double a0Inv = 1.0 / (double) c[3];
+        s.b0 = Reg::expand((double) c[0] * a0Inv);
+        s.b1 = Reg::expand((double) c[1] * a0Inv);
+        s.b2 = Reg::expand((double) c[2] * a0Inv);
+        s.a1 = Reg::expand((double) c[4] * a0Inv);
+        s.a2 = Reg::expand((double) c[5] * a0Inv);
+    }
+
+    // Passes the signal through unchanged.
+    void setIdentity(int index) noexcept { setSection(index, { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f }); }
+
+    void reset() noexcept
+    {
+        for (auto& z : state)
+            z = Reg::expand(0.0);
+    }
+
+    // Filters in place. right may be null for mono, in which case the right lane shadows the left.
+    void process(float* left, float* right, int numSamples) noexcept
+    {
+        alignas(Reg::SIMDRegisterSize) double io[Reg::SIMDNumElements] {};
+
+        // Work on a local copy so the state stays in registers across the loop
+        auto z = state;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            io[0] = (double) left[i];
+            io[1] = (double) (right != nullptr ? right[i] : left[i]);
+            auto x = Reg::fromRawArray(io);
+
+            for (size_t s = 0; s < (size_t) NumSections; ++s)
+            {
+                const auto& c = sections[s];
+                auto& z1 = z[2 * s];
+                auto& z2 = z[2 * s + 1];
+
+                const auto y = c.b0 * x + z1;
+                z1 = c.b1 * x - c.a1 * y + z2;
+                z2 = c.b2 * x - c.a2 * y;
+                x = y;
+            }
+
+            x.copyToRawArray(io);
+            left[i] = (float) io[0];
+            if (right != nullptr)
+                right[i] = (float) io[1];
+        }
+
+        state = z;
+    }
+
+private:
+    using Reg = juce::dsp::SIMDRegister<double>;
+    static_assert(Reg::SIMDNumElements >= 2, "Both channels must fit in one register");
+
+    struct Section
+    {
+        Reg b0, b1, b2, a1, a2;
+    };
+
+    std::array<Section, (size_t) NumSections> sections;
+    std::array<Reg, (size_t) NumSections * 2> state; // z1, z2 per section
+};
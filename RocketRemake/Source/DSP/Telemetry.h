@@ -0,0 +1,100 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+// =============================================================================
+// SeqLock - single-writer snapshot that readers copy without blocking the writer
+//
+// The writer bumps the sequence to odd, stores the payload, then bumps it to even.
+// A reader copies the payload between two sequence reads and retries if they
+// differ or were odd. The payload lives in relaxed atomic words, so a torn read is
+// detected rather than being a data race. The writer is wait-free; readers spin
+// only while a write is in progress.
+// =============================================================================
+template <typename T>
+class SeqLock
+{
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock payloads are copied bytewise");
+
+    // Writer (one thread only).
+    void store(const T& value) noexcept
+    {
+        const auto seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        Words buffer {};
+        std::memcpy(buffer.data(), &value, sizeof(T));
+        for (size_t i = 0; i < kNumWords; ++i)
+            words[i].store(buffer[i], std::memory_order_relaxed);
+
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    // Readers (any thread): false if a write overlapped the copy.
+    bool tryLoad(T& result) const noexcept
+    {
+        const auto before = sequence.load(std::memory_order_acquire);
+        if ((before & 1) != 0)
+            return false;
+
+        Words buffer;
+        for (size_t i = 0; i < kNumWords; ++i)
+            buffer[i] = words[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) != before)
+            return false;
+
+        std::memcpy(&result, buffer.data(), sizeof(T));
+        return true;
+    }
+
+    // Readers (any thread): retries until a consistent copy is read.
+    T load() const noexcept
+    {
+        T result {};
+        while (! tryLoad(result))
+            std::this_thread::yield();
+        return result;
+    }
+
+private:
+    static constexpr size_t kNumWords = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+    using Words = std::array<std::uint64_t, kNumWords>;
+
+    alignas(64) std::atomic<std::uint32_t> sequence { 0 };
+    alignas(64) std::array<std::atomic<std::uint64_t>, kNumWords> words {};
+};
+
+// =============================================================================
+// TelemetryFrame - what the audio thread reports to the UI once per block
+// =============================================================================
+struct TelemetryFrame
+{
+    static constexpr int kMaxChannels = 2;
+    static constexpr int kMaxTargets = 128;
+
+    struct Target
+    {
+        int paramIndex = -1; // processor parameter index
+        float value = 0.0f;  // effective value after modulation, in the parameter's own range
+    };
+
+    std::uint64_t blockCounter = 0; // 0 until the first block is processed
+    float smoothedAmount = 0.0f;
+
+    int numChannels = 0;
+    std::array<float, kMaxChannels> peak {};
+    std::array<float, kMaxChannels> rms {};
+
+    int numTargets = 0;
+    std::array<Target, kMaxTargets> targets {};
+};
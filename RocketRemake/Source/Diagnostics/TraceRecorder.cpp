@@ -0,0 +1,252 @@
+#include "TraceRecorder.h"
+
+#if defined(ROCKET_TRACE) && ROCKET_TRACE
+
+#include <array>
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+    constexpr int kMaxThreads = 16;
+    constexpr int kRingCapacity = 1 << 13; // events per thread between drains
+    constexpr int kMaxNameLength = 39;
+    constexpr int kDrainIntervalMs = 20;
+
+    struct Event
+    {
+        std::int64_t startNanos;
+        std::int64_t endNanos;
+        char name[kMaxNameLength + 1];
+    };
+
+    // Single producer (the owning thread), single consumer (the drain thread).
+    struct alignas(64) ThreadRing
+    {
+        std::atomic<bool> claimed { false };
+        alignas(64) std::atomic<std::uint32_t> writeIndex { 0 };
+        alignas(64) std::atomic<std::uint32_t> readIndex { 0 };
+        std::atomic<std::uint32_t> dropped { 0 };
+        std::array<Event, kRingCapacity> events;
+    };
+
+    // Trivially destructible, so a thread's first event registers no TLS destructor (that would
+    // allocate). Rings are not released when a thread exits; stop() releases them all and bumps the
+    // generation, so each thread claims afresh in the next recording.
+    struct ThreadSlot
+    {
+        ThreadRing* ring;         // null with a current generation: every ring was taken
+        std::uint32_t generation; // claim generation the ring belongs to; 0 is never current
+    };
+
+    thread_local ThreadSlot threadSlot {};
+}
+
+// =============================================================================
+class TraceRecorder::Impl : private juce::Thread
+{
+public:
+    Impl() : juce::Thread("Rocket Trace Writer")
+    {
+        for (auto& ring : rings)
+            ring = std::make_unique<ThreadRing>();
+    }
+
+    ~Impl() override { stop(); }
+
+    void start()
+    {
+        auto file = juce::File(juce::SystemStats::getEnvironmentVariable("ROCKET_TRACE_FILE", {}));
+        if (file == juce::File())
+        {
+            auto folder = juce::File::getSpecialLocation(juce::File::userDocumentsDirectory)
+                              .getChildFile("TheRocket")
+                              .getChildFile("Traces");
+            folder.createDirectory();
+            file = folder.getChildFile("TheRocket-" + juce::Time::getCurrentTime().formatted("%Y%m%d-%H%M%S") + ".json");
+        }
+
+        file.deleteFile();
+        output = std::make_unique<juce::FileOutputStream>(file);
+        if (output->failedToOpen())
+        {
+            DBG("TraceRecorder: cannot write " + file.getFullPathName());
+            output.reset();
+            return;
+        }
+
+        DBG("TraceRecorder: writing " + file.getFullPathName());
+        *output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        firstEvent = true;
+        originNanos = nowNanos();
+        recording.store(true, std::memory_order_release);
+        startThread();
+    }
+
+    void stop()
+    {
+        if (output == nullptr)
+            return;
+
+        recording.store(false, std::memory_order_release);
+        stopThread(2000);
+        drain(); // whatever was recorded after the thread's last pass
+
+        for (int i = 0; i < kMaxThreads; ++i)
+            if (const auto dropped = rings[(size_t) i]->dropped.exchange(0))
+                DBG("TraceRecorder: thread " + juce::String(i) + " dropped " + juce::String(dropped) + " events");
+
+        *output << "\n]}\n";
+        output->flush();
+        output.reset();
+
+        for (auto& ring : rings)
+        {
+            ring->writeIndex.store(0, std::memory_order_relaxed);
+            ring->readIndex.store(0, std::memory_order_relaxed);
+            ring->claimed.store(false, std::memory_order_relaxed);
+        }
+        generation.fetch_add(1, std::memory_order_release);
+    }
+
+    void record(const char* name, std::int64_t startNanos, std::int64_t endNanos) noexcept
+    {
+        if (! recording.load(std::memory_order_acquire))
+            return;
+
+        auto* ring = claimRing();
+        if (ring == nullptr)
+            return;
+
+        const auto write = ring->writeIndex.load(std::memory_order_relaxed);
+        const auto read = ring->readIndex.load(std::memory_order_acquire);
+        if (write - read >= (std::uint32_t) kRingCapacity)
+        {
+            ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto& event = ring->events[write % kRingCapacity];
+        event.startNanos = startNanos;
+        event.endNanos = endNanos;
+        std::strncpy(event.name, name != nullptr ? name : "?", kMaxNameLength);
+        event.name[kMaxNameLength] = 0;
+
+        ring->writeIndex.store(write + 1, std::memory_order_release);
+    }
+
+private:
+    ThreadRing* claimRing() noexcept
+    {
+        const auto current = generation.load(std::memory_order_acquire);
+        if (threadSlot.generation == current)
+            return threadSlot.ring;
+
+        threadSlot = { nullptr, current };
+        for (auto& ring : rings)
+        {
+            bool expected = false;
+            if (ring->claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+                return threadSlot.ring = ring.get();
+        }
+
+        return nullptr;
+    }
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            drain();
+            wait(kDrainIntervalMs);
+        }
+    }
+
+    void drain()
+    {
+        for (int tid = 0; tid < kMaxThreads; ++tid)
+        {
+            auto& ring = *rings[(size_t) tid];
+            const auto write = ring.writeIndex.load(std::memory_order_acquire);
+            auto read = ring.readIndex.load(std::memory_order_relaxed);
+
+            for (; read != write; ++read)
+                writeEvent(ring.events[read % kRingCapacity], tid);
+
+            ring.readIndex.store(read, std::memory_order_release);
+        }
+
+        output->flush();
+    }
+
+    void writeEvent(const Event& event, int tid)
+    {
+        const double startMicros = (double) (event.startNanos - originNanos) * 1.0e-3;
+        const double durationMicros = (double) (event.endNanos - event.startNanos) * 1.0e-3;
+
+        if (! firstEvent)
+            *output << ",\n";
+        firstEvent = false;
+
+        *output << "{\"name\":" << juce::JSON::toString(juce::String(event.name))
+                << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                << ",\"ts\":" << juce::String(startMicros, 3)
+                << ",\"dur\":" << juce::String(durationMicros, 3) << "}";
+    }
+
+    std::array<std::unique_ptr<ThreadRing>, kMaxThreads> rings;
+    std::unique_ptr<juce::FileOutputStream> output;
+    std::atomic<bool> recording { false };
+    std::atomic<std::uint32_t> generation { 1 }; // bumped by stop(); see ThreadSlot
+    std::int64_t originNanos = 0;
+    bool firstEvent = true;
+};
+
+// =============================================================================
+TraceRecorder::TraceRecorder() : impl(std::make_unique<Impl>()) {}
+TraceRecorder::~TraceRecorder() = default;
+
+// The processor's Session makes the first call, so the audio thread never runs the static initialiser.
+TraceRecorder& TraceRecorder::getInstance()
+{
+    static TraceRecorder instance;
+    return instance;
+}
+
+std::int64_t TraceRecorder::nowNanos() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void TraceRecorder::record(const char* name, std::int64_t startNanos, std::int64_t endNanos) noexcept
+{
+    impl->record(name, startNanos, endNanos);
+}
+
+void TraceRecorder::addSession()
+{
+    const juce::ScopedLock sl(sessionLock);
+    if (numSessions++ == 0)
+        impl->start();
+}
+
+void TraceRecorder::removeSession()
+{
+    const juce::ScopedLock sl(sessionLock);
+    if (--numSessions == 0)
+        impl->stop();
+}
+
+TraceRecorder::Session::Session() { getInstance().addSession(); }
+TraceRecorder::Session::~Session() { getInstance().removeSession(); }
+
+TraceRecorder::Scope::Scope(const char* eventName) noexcept
+    : name(eventName), startNanos(nowNanos()) {}
+
+TraceRecorder::Scope::~Scope() noexcept
+{
+    getInstance().record(name, startNanos, nowNanos());
+}
+
+#endif
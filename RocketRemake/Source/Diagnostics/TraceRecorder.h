@@ -0,0 +1,79 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+// =============================================================================
+// TraceRecorder - Chrome trace / Perfetto timeline of the plugin's hot paths
+//
+// ROCKET_TRACE_SCOPE("name") records one complete ("X") event covering the rest
+// of the enclosing scope. Each thread writes into its own preallocated
+// single-producer ring, claimed lock-free on the thread's first event and held
+// until the recording stops, so the audio thread never allocates or blocks. A
+// background thread drains the rings into a JSON file that chrome://tracing and
+// ui.perfetto.dev open directly.
+//
+// Only compiled in when ROCKET_TRACE is set; otherwise the macro is empty.
+// The file goes to $ROCKET_TRACE_FILE, or Documents/TheRocket/Traces.
+// =============================================================================
+#if defined(ROCKET_TRACE) && ROCKET_TRACE
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+class TraceRecorder
+{
+public:
+    // Keeps the process-wide recorder running while at least one session exists.
+    // The processor holds one, so a trace covers the lifetime of the plugin.
+    class Session
+    {
+    public:
+        Session();
+        ~Session();
+
+        JUCE_DECLARE_NON_COPYABLE(Session)
+    };
+
+    // Times the enclosing scope. name is only copied when the scope ends, so it must outlive the
+    // scope: a literal, or a string owned by something that lives longer than the enclosing block.
+    class Scope
+    {
+    public:
+        explicit Scope(const char* eventName) noexcept;
+        ~Scope() noexcept;
+
+    private:
+        const char* name;
+        std::int64_t startNanos;
+
+        JUCE_DECLARE_NON_COPYABLE(Scope)
+    };
+
+    static std::int64_t nowNanos() noexcept;
+
+private:
+    TraceRecorder();
+    ~TraceRecorder();
+    static TraceRecorder& getInstance();
+
+    void record(const char* name, std::int64_t startNanos, std::int64_t endNanos) noexcept;
+
+    void addSession();
+    void removeSession();
+
+    class Impl;
+    const std::unique_ptr<Impl> impl; // rings are allocated once, up front
+    juce::CriticalSection sessionLock; // message thread only; never taken by record()
+    int numSessions = 0;
+};
+
+ #define ROCKET_TRACE_CONCAT_INNER(a, b) a##b
+ #define ROCKET_TRACE_CONCAT(a, b) ROCKET_TRACE_CONCAT_INNER(a, b)
+ #define ROCKET_TRACE_SCOPE(name) const TraceRecorder::Scope ROCKET_TRACE_CONCAT(rocketTraceScope_, __LINE__) (name)
+
+#else
+
+ #define ROCKET_TRACE_SCOPE(name)
+
+#endif
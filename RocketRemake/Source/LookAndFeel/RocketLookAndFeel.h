@@ -1,6 +1,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <vector>
 
 class RocketLookAndFeel final : public juce::LookAndFeel_V4
 {
@@ -44,56 +45,18 @@ public:
                           float rotaryEndAngle,
                           juce::Slider&) override
     {
-        g.setImageResamplingQuality(juce::Graphics::highResamplingQuality);
-
-        const auto bounds = juce::Rectangle<float>((float) x, (float) y, (float) width, (float) height)
-                                .reduced(juce::jmax(2.0f, 0.06f * (float) juce::jmin(width, height)));
-
-        const auto radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) * 0.5f;
-        const auto centre = bounds.getCentre();
-        const auto angle = rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
-
-        const auto outline = findColour(juce::Slider::rotarySliderOutlineColourId);
-        const auto fill = findColour(juce::Slider::rotarySliderFillColourId);
-        const auto thumb = findColour(juce::Slider::thumbColourId);
-
-        const float ringThickness = juce::jlimit(3.0f, 10.0f, radius * 0.13f);
-
-        // Background arc
-        juce::Path bgArc;
-        bgArc.addCentredArc(centre.x, centre.y, radius - ringThickness, radius - ringThickness, 0.0f, rotaryStartAngle,
-                            rotaryEndAngle, true);
-        g.setColour(outline);
-        g.strokePath(bgArc, juce::PathStrokeType(ringThickness, juce::PathStrokeType::curved,
-                                                 juce::PathStrokeType::rounded));
-
-        // Value arc
-        juce::Path valueArc;
-        valueArc.addCentredArc(centre.x, centre.y, radius - ringThickness, radius - ringThickness, 0.0f, rotaryStartAngle,
-                               angle, true);
-        g.setColour(fill);
-        g.strokePath(valueArc, juce::PathStrokeType(ringThickness, juce::PathStrokeType::curved,
-                                                    juce::PathStrokeType::rounded));
-
-        // Inner circle with gradient
-        const auto inner = bounds.reduced(ringThickness * 1.15f);
-        g.setGradientFill(juce::ColourGradient(juce::Colour::fromRGB(22, 22, 28), inner.getTopLeft(),
-                                              juce::Colour::fromRGB(44, 46, 58), inner.getBottomRight(), false));
-        g.fillEllipse(inner);
-
-        g.setColour(juce::Colours::black.withAlpha(0.55f));
-        g.drawEllipse(inner, 1.0f);
-
-        // Thumb indicator
-        const float dotRadius = juce::jlimit(3.0f, 7.5f, radius * 0.10f);
-        const float dotDistance = radius - ringThickness * 0.65f;
-        const juce::Point<float> dot { centre.x + dotDistance * std::cos(angle),
-                                       centre.y + dotDistance * std::sin(angle) };
-
-        g.setColour(thumb);
-        g.fillEllipse(dot.x - dotRadius, dot.y - dotRadius, dotRadius * 2.0f, dotRadius * 2.0f);
-        g.setColour(juce::Colours::black.withAlpha(0.35f));
-        g.drawEllipse(dot.x - dotRadius, dot.y - dotRadius, dotRadius * 2.0f, dotRadius * 2.0f, 1.0f);
+        // Blit the nearest pre-rendered frame; unusual or still-changing sizes fall back to drawing the paths
+        const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        if (const auto* frame = getKnobFrame(width, height, pixelScale, sliderPosProportional, rotaryStartAngle, rotaryEndAngle))
+        {
+            g.drawImageTransformed(*frame, juce::AffineTransform::scale(1.0f / knobFilmstrip.key.pixelScale)
+                                               .translated((float) x, (float) y));
+            return;
+        }
+
+        drawKnob(g, juce::Rectangle<float>((float) x, (float) y, (float) width, (float) height),
+                 rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle),
+                 rotaryStartAngle, rotaryEndAngle);
     }
 
     void drawButtonBackground(juce::Graphics& g,
@@ -181,4 +144,159 @@ public:
                             .withTrimmedRight(2),
                          juce::Justification::centredLeft, 10);
     }
+
+private:
+    // Knob filmstrip: every angle rendered at most once per size, display scale and colour set.
+    // A new size only gets a strip once it has held for kKnobSettleMs, so a resize drag draws
+    // paths instead of building a strip per step; frames are then rendered as they are first shown.
+    static constexpr int kMaxKnobFrames = 128;
+    static constexpr int kMinKnobFrames = 48;
+    static constexpr int kMaxFilmstripSide = 320;                  // physical pixels; larger knobs draw paths
+    static constexpr size_t kFilmstripBudgetBytes = 24 * 1024 * 1024;
+    static constexpr juce::uint32 kKnobSettleMs = 250;
+
+    struct KnobKey
+    {
+        int width = 0;
+        int height = 0;
+        float pixelScale = 0.0f;
+        float startAngle = 0.0f;
+        float endAngle = 0.0f;
+        juce::Colour outline, fill, thumb;
+
+        bool operator== (const KnobKey& other) const noexcept
+        {
+            return width == other.width && height == other.height && pixelScale == other.pixelScale
+                && startAngle == other.startAngle && endAngle == other.endAngle
+                && outline == other.outline && fill == other.fill && thumb == other.thumb;
+        }
+
+        bool operator!= (const KnobKey& other) const noexcept { return !operator== (other); }
+    };
+
+    struct KnobFilmstrip
+    {
+        KnobKey key;
+        juce::Image sheet;                // frames stacked vertically
+        std::vector<juce::Image> frames;  // views into sheet
+        std::vector<bool> rendered;
+    };
+
+    KnobFilmstrip knobFilmstrip;
+    KnobKey settlingKnobKey;              // last size asked for that has no strip yet
+    juce::uint32 settlingKnobSince = 0;
+
+    const juce::Image* getKnobFrame(int width, int height, float pixelScale, float sliderPos,
+                                    float rotaryStartAngle, float rotaryEndAngle)
+    {
+        const int frameW = juce::roundToInt((float) width * pixelScale);
+        const int frameH = juce::roundToInt((float) height * pixelScale);
+
+        if (frameW <= 0 || frameH <= 0 || juce::jmax(frameW, frameH) > kMaxFilmstripSide)
+            return nullptr;
+
+        auto& strip = knobFilmstrip;
+        KnobKey key;
+        key.width = width;
+        key.height = height;
+        key.pixelScale = pixelScale;
+        key.startAngle = rotaryStartAngle;
+        key.endAngle = rotaryEndAngle;
+        key.outline = findColour(juce::Slider::rotarySliderOutlineColourId);
+        key.fill = findColour(juce::Slider::rotarySliderFillColourId);
+        key.thumb = findColour(juce::Slider::thumbColourId);
+
+        if (strip.frames.empty() || strip.key != key)
+        {
+            // Still changing (resize drag, display move): keep drawing paths until it settles
+            const auto now = juce::Time::getMillisecondCounter();
+            if (settlingKnobKey != key)
+            {
+                settlingKnobKey = key;
+                settlingKnobSince = now;
+                return nullptr;
+            }
+
+            if (now - settlingKnobSince < kKnobSettleMs)
+                return nullptr;
+
+            const auto frameBytes = (size_t) frameW * (size_t) frameH * 4;
+            const int numFrames = juce::jlimit(kMinKnobFrames, kMaxKnobFrames, (int) (kFilmstripBudgetBytes / frameBytes));
+
+            strip = {};
+            strip.key = key;
+            strip.sheet = juce::Image(juce::Image::ARGB, frameW, frameH * numFrames, true);
+            strip.frames.reserve((size_t) numFrames);
+            for (int i = 0; i < numFrames; ++i)
+                strip.frames.push_back(strip.sheet.getClippedImage({ 0, i * frameH, frameW, frameH }));
+            strip.rendered.assign((size_t) numFrames, false);
+        }
+
+        const int index = juce::roundToInt(juce::jlimit(0.0f, 1.0f, sliderPos) * (float) (strip.frames.size() - 1));
+
+        if (!strip.rendered[(size_t) index])
+        {
+            const float pos = (float) index / (float) (strip.frames.size() - 1);
+            juce::Graphics sg(strip.sheet);
+            sg.addTransform(juce::AffineTransform::scale(pixelScale).translated(0.0f, (float) (index * frameH)));
+            sg.reduceClipRegion(0, 0, width, height);
+            drawKnob(sg, juce::Rectangle<float>(0.0f, 0.0f, (float) width, (float) height),
+                     rotaryStartAngle + pos * (rotaryEndAngle - rotaryStartAngle), rotaryStartAngle, rotaryEndAngle);
+            strip.rendered[(size_t) index] = true;
+        }
+
+        return &strip.frames[(size_t) index];
+    }
+
+    void drawKnob(juce::Graphics& g, juce::Rectangle<float> area, float angle, float rotaryStartAngle, float rotaryEndAngle)
+    {
+        g.setImageResamplingQuality(juce::Graphics::highResamplingQuality);
+
+        const auto bounds = area.reduced(juce::jmax(2.0f, 0.06f * juce::jmin(area.getWidth(), area.getHeight())));
+
+        const auto radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) * 0.5f;
+        const auto centre = bounds.getCentre();
+
+        const auto outline = findColour(juce::Slider::rotarySliderOutlineColourId);
+        const auto fill = findColour(juce::Slider::rotarySliderFillColourId);
+        const auto thumb = findColour(juce::Slider::thumbColourId);
+
+        const float ringThickness = juce::jlimit(3.0f, 10.0f, radius * 0.13f);
+
+        // Background arc
+        juce::Path bgArc;
+        bgArc.addCentredArc(centre.x, centre.y, radius - ringThickness, radius - ringThickness, 0.0f, rotaryStartAngle,
+                            rotaryEndAngle, true);
+        g.setColour(outline);
+        g.strokePath(bgArc, juce::PathStrokeType(ringThickness, juce::PathStrokeType::curved,
+                                                 juce::PathStrokeType::rounded));
+
+        // Value arc
+        juce::Path valueArc;
+        valueArc.addCentredArc(centre.x, centre.y, radius - ringThickness, radius - ringThickness, 0.0f, rotaryStartAngle,
+                               angle, true);
+        g.setColour(fill);
+        g.strokePath(valueArc, juce::PathStrokeType(ringThickness, juce::PathStrokeType::curved,
+                                                    juce::PathStrokeType::rounded));
+
+        // Inner circle with gradient
+        const auto inner = bounds.reduced(ringThickness * 1.15f);
+        g.setGradientFill(juce::ColourGradient(juce::Colour::fromRGB(22, 22, 28), inner.getTopLeft(),
+                                              juce::Colour::fromRGB(44, 46, 58), inner.getBottomRight(), false));
+        g.fillEllipse(inner);
+
+        g.setColour(juce::Colours::black.withAlpha(0.55f));
+        g.drawEllipse(inner, 1.0f);
+
+        // Thumb indicator
+        const float dotRadius = juce::jlimit(3.0f, 7.5f, radius * 0.10f);
+        const float dotDistance = radius - ringThickness * 0.65f;
+        const juce::Point<float> dot { centre.x + dotDistance * std::cos(angle),
+                                       centre.y + dotDistance * std::sin(angle) };
+
+        g.setColour(thumb);
+        g.fillEllipse(dot.x - dotRadius, dot.y - dotRadius, dotRadius * 2.0f, dotRadius * 2.0f);
+        g.setColour(juce::Colours::black.withAlpha(0.35f));
+        g.drawEllipse(dot.x - dotRadius, dot.y - dotRadius, dotRadius * 2.0f, dotRadius * 2.0f, 1.0f);
+    }
 };
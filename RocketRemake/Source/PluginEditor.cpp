@@ -1,4 +1,5 @@
 #include "PluginEditor.h"
+#include <array>
 
 namespace
 {
@@ -81,6 +82,137 @@ namespace
 
         return l;
     }
+
+    // Crop transparent padding from the source art for consistent sizing.
+    const juce::Rectangle<int> kRocketSource { 36, 47, 54, 206 };
+    const juce::Rectangle<int> kFlameSource { 7, 231, 106, 314 };
+    constexpr std::array<float, 3> kCloudOpacities { 0.85f, 0.80f, 0.85f };
+
+    // Where the animated sprites sit for a given Amount (0..1)
+    struct SpriteLayout
+    {
+        std::array<juce::Rectangle<int>, 3> clouds;
+        juce::Rectangle<int> rocket;
+        juce::Rectangle<int> flame; // empty while the flame is off
+        float flameOpacity = 0.0f;
+    };
+
+    SpriteLayout makeSpriteLayout(const MainUiLayout& layout, int width, float knobValue, const juce::Image& cloudsImg,
+                                  bool hasRocket, bool hasFlame)
+    {
+        SpriteLayout sprites;
+
+        // Clouds - keep correct aspect ratio
+        if (cloudsImg.isValid())
+        {
+            const float cloudAspect = (float) cloudsImg.getWidth() / (float) cloudsImg.getHeight();
+            const int cloudW = juce::roundToInt(190.0f * layout.scale);
+            const int cloudH = juce::roundToInt(cloudW / cloudAspect);
+
+            const float topBand = (float) juce::roundToInt(28.0f * layout.scale);
+
+            // Cloud 1 - left
+            const float c1x = 22.0f * layout.scale + knobValue * 18.0f * layout.scale;
+            const float c1y = topBand + 40.0f * layout.scale - knobValue * 60.0f * layout.scale;
+
+            // Cloud 2 - center
+            const float c2x = (float) (width / 2 - cloudW / 2) + knobValue * 25.0f * layout.scale;
+            const float c2y = topBand + 12.0f * layout.scale - knobValue * 72.0f * layout.scale;
+
+            // Cloud 3 - right
+            const float c3x = (float) (width - cloudW) - 22.0f * layout.scale - knobValue * 20.0f * layout.scale;
+            const float c3y = topBand + 68.0f * layout.scale - knobValue * 56.0f * layout.scale;
+
+            sprites.clouds = { juce::Rectangle<int>(juce::roundToInt(c1x), juce::roundToInt(c1y), cloudW, cloudH),
+                               juce::Rectangle<int>(juce::roundToInt(c2x), juce::roundToInt(c2y), cloudW, cloudH),
+                               juce::Rectangle<int>(juce::roundToInt(c3x), juce::roundToInt(c3y), cloudW, cloudH) };
+        }
+
+        if (! hasRocket)
+            return sprites;
+
+        // Rocket - launches upward from above the panel
+        const float topMargin = 40.0f * layout.scale;
+        const float padOffset = 18.0f * layout.scale;
+
+        const float rocketAspect = (float) kRocketSource.getWidth() / (float) kRocketSource.getHeight();
+        const int rocketH = juce::roundToInt(120.0f * layout.scale);
+        const int rocketW = juce::roundToInt((float) rocketH * rocketAspect);
+
+        const float maxLift = juce::jmax(0.0f, (float) layout.animationArea.getHeight() - topMargin - (float) rocketH - padOffset);
+        const float baseY = (float) layout.animationArea.getHeight() - padOffset - (float) rocketH;
+        const float rocketY = baseY - knobValue * knobValue * maxLift;
+
+        sprites.rocket = { width / 2 - rocketW / 2, juce::roundToInt(rocketY), rocketW, rocketH };
+
+        // Flame - anchored under the rocket (stays clipped above the panel)
+        if (hasFlame && knobValue > 0.03f && rocketH > 0)
+        {
+            const float flameAspect = (float) kFlameSource.getWidth() / (float) kFlameSource.getHeight();
+            const float intensity = juce::jlimit(0.0f, 1.0f, (knobValue - 0.03f) / 0.97f);
+
+            const float flameScale = 0.65f + intensity * 0.95f;
+            const int flameH = juce::roundToInt((float) rocketH * 1.15f * flameScale);
+            const int flameW = juce::roundToInt((float) flameH * flameAspect);
+
+            const float overlap = (float) rocketH * 0.10f;
+            const float flameY = rocketY + (float) rocketH - overlap;
+
+            sprites.flame = { width / 2 - flameW / 2, juce::roundToInt(flameY), flameW, flameH };
+            sprites.flameOpacity = 0.65f + intensity * 0.35f;
+        }
+
+        return sprites;
+    }
+
+    // The scaled artwork an editor of the given size draws at pixelScale, indexed by UiAssetCache::Asset.
+    // Requests for missing images stay empty.
+    struct ArtworkPlan
+    {
+        std::array<UiAssetCache::ScaledRequest, UiAssetCache::kNumAssets> requests;
+        juce::Point<int> backgroundOrigin; // in backdrop pixels
+    };
+
+    ArtworkPlan planArtwork(juce::Rectangle<int> bounds, float pixelScale, const juce::Image& backgroundImg,
+                            const juce::Image& panelImg, const juce::Image& cloudsImg, bool hasRocket, bool hasFlame)
+    {
+        using Asset = UiAssetCache::Asset;
+
+        ArtworkPlan plan;
+        auto request = [&plan, pixelScale] (Asset asset, juce::Rectangle<int> sourceArea, int w, int h)
+        {
+            plan.requests[(size_t) asset] = { asset, sourceArea, juce::roundToInt((float) w * pixelScale),
+                                              juce::roundToInt((float) h * pixelScale) };
+        };
+
+        // Background fills the backdrop without aspect distortion (cropped if needed)
+        if (backgroundImg.isValid())
+        {
+            const juce::Rectangle<float> backdrop { (float) juce::roundToInt((float) bounds.getWidth() * pixelScale),
+                                                    (float) juce::roundToInt((float) bounds.getHeight() * pixelScale) };
+            const auto placed = juce::RectanglePlacement(juce::RectanglePlacement::fillDestination)
+                                    .appliedTo(backgroundImg.getBounds().toFloat(), backdrop)
+                                    .toNearestInt();
+            plan.requests[(size_t) Asset::background] = { Asset::background, backgroundImg.getBounds(), placed.getWidth(),
+                                                          placed.getHeight() };
+            plan.backgroundOrigin = placed.getPosition();
+        }
+
+        const auto layout = makeMainLayout(bounds, panelImg);
+        if (panelImg.isValid())
+            request(Asset::panel, panelImg.getBounds(), layout.panel.getWidth(), layout.panel.getHeight());
+
+        // Sprites at the size they are drawn; their positions depend on Amount, their sizes do not
+        const auto sprites = makeSpriteLayout(layout, bounds.getWidth(), 1.0f, cloudsImg, hasRocket, hasFlame);
+        if (cloudsImg.isValid())
+            request(Asset::clouds, cloudsImg.getBounds(), sprites.clouds[0].getWidth(), sprites.clouds[0].getHeight());
+        if (hasRocket)
+            request(Asset::rocket, kRocketSource, sprites.rocket.getWidth(), sprites.rocket.getHeight());
+        if (hasFlame)
+            request(Asset::flame, kFlameSource, sprites.flame.getWidth(), sprites.flame.getHeight());
+
+        return plan;
+    }
 }
 
 // =============================================================================
@@ -109,7 +241,21 @@ public:
         auto name = order[row];
         g.fillAll(rowSelected ? juce::Colours::darkgrey : juce::Colours::black);
         g.setColour(juce::Colours::white);
+
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+        // Name on top, cost of the module in the last / average / worst host block below
+        const auto stats = processor.getFxChain().getModuleStats(name);
+        const double percent = stats.budgetMicros > 0.0 ? 100.0 * stats.averageMicros / stats.budgetMicros : 0.0;
+
+        g.drawText(name, 8, 0, width - 16, height / 2, juce::Justification::centredLeft);
+        g.setColour(percent >= 10.0 ? juce::Colours::orange : juce::Colours::grey);
+        g.setFont(11.0f);
+        g.drawText(juce::String(stats.currentMicros, 1) + " / " + juce::String(stats.averageMicros, 1) + " / "
+                       + juce::String(stats.peakMicros, 1) + " us  " + juce::String(percent, 1) + "%",
+                   8, height / 2, width - 16, height / 2, juce::Justification::centredLeft);
+#else
         g.drawText(name, 8, 0, width - 16, height, juce::Justification::centredLeft);
+#endif
     }
 
     void listBoxItemClicked(int row, const juce::MouseEvent&) override
@@ -128,7 +274,8 @@ private:
 class AssignmentListModel : public juce::ListBoxModel
 {
 public:
-    AssignmentListModel(TheRocketAudioProcessor& p, juce::ListBox& lb) : processor(p), list(lb) {}
+    AssignmentListModel(TheRocketAudioProcessor& p, juce::ListBox& lb, const TelemetryFrame& telemetryIn)
+        : processor(p), list(lb), telemetry(telemetryIn) {}
 
     int getNumRows() override 
     { 
@@ -151,6 +298,21 @@ public:
         auto text = a.paramID + "  amt=" + juce::String(a.amount, 2);
         if (a.useRange)
             text += " range=" + juce::String(a.min, 2) + ":" + juce::String(a.max, 2);
+
+        // Effective value the audio thread reported for this target in its last block
+        if (auto* param = processor.getAPVTS().getParameter(a.paramID))
+        {
+            const int paramIndex = param->getParameterIndex();
+            for (int i = 0; i < telemetry.numTargets; ++i)
+            {
+                if (telemetry.targets[(size_t)i].paramIndex == paramIndex)
+                {
+                    text += "  -> " + juce::String(telemetry.targets[(size_t)i].value, 3);
+                    break;
+                }
+            }
+        }
+
         g.drawText(text, 8, 0, width - 16, height, juce::Justification::centredLeft);
     }
 
@@ -162,6 +324,225 @@ public:
 private:
     TheRocketAudioProcessor& processor;
     juce::ListBox& list;
+    const TelemetryFrame& telemetry;
+};
+
+// =============================================================================
+// Parameter List Model
+//
+// Virtualised: the ListBox only asks for rows that are on screen and hands back
+// rows that scrolled away, so widgets and APVTS attachments exist for visible
+// parameters only and are rebound as the list scrolls.
+// =============================================================================
+class ParameterRow : public juce::Component
+{
+public:
+    ParameterRow()
+    {
+        label.setColour(juce::Label::textColourId, juce::Colour::fromFloatRGBA(0.8f, 0.8f, 0.9f, 1.0f));
+        label.setFont(juce::Font(12.0f));
+        addAndMakeVisible(label);
+
+        toggle.setColour(juce::ToggleButton::tickColourId, juce::Colour::fromFloatRGBA(1.0f, 0.6f, 0.2f, 1.0f));
+        toggle.setColour(juce::ToggleButton::tickDisabledColourId, juce::Colour::fromFloatRGBA(0.5f, 0.5f, 0.5f, 1.0f));
+        toggle.setColour(juce::ToggleButton::textColourId, juce::Colour::fromFloatRGBA(0.9f, 0.9f, 1.0f, 1.0f));
+        addChildComponent(toggle);
+
+        slider.setColour(juce::Slider::backgroundColourId, juce::Colour::fromFloatRGBA(0.2f, 0.2f, 0.3f, 1.0f));
+        slider.setColour(juce::Slider::trackColourId, juce::Colour::fromFloatRGBA(0.4f, 0.4f, 0.5f, 1.0f));
+        slider.setColour(juce::Slider::rotarySliderFillColourId, juce::Colour::fromFloatRGBA(1.0f, 0.6f, 0.2f, 1.0f));
+        slider.setColour(juce::Slider::rotarySliderOutlineColourId, juce::Colour::fromFloatRGBA(0.8f, 0.8f, 0.9f, 1.0f));
+        slider.setColour(juce::Slider::thumbColourId, juce::Colour::fromFloatRGBA(0.9f, 0.9f, 1.0f, 1.0f));
+        slider.setColour(juce::Slider::textBoxTextColourId, juce::Colour::fromFloatRGBA(0.9f, 0.9f, 1.0f, 1.0f));
+        slider.setColour(juce::Slider::textBoxBackgroundColourId, juce::Colour::fromFloatRGBA(0.3f, 0.3f, 0.4f, 1.0f));
+        slider.setColour(juce::Slider::textBoxOutlineColourId, juce::Colour::fromFloatRGBA(0.6f, 0.6f, 0.7f, 1.0f));
+        slider.setTextValueSuffix(" ");
+        addChildComponent(slider);
+    }
+
+    // Points the row at another parameter; the old attachment is dropped first.
+    void bind(juce::AudioProcessorValueTreeState& apvts, const juce::String& paramId)
+    {
+        if (paramId == boundId)
+            return;
+
+        sliderAttachment.reset();
+        buttonAttachment.reset();
+        boundId = paramId;
+
+        auto* param = apvts.getParameter(paramId);
+        const bool isBool = dynamic_cast<juce::AudioParameterBool*>(param) != nullptr;
+
+        label.setText(param != nullptr ? param->getName(64) : juce::String(), juce::dontSendNotification);
+        toggle.setVisible(param != nullptr && isBool);
+        slider.setVisible(param != nullptr && ! isBool);
+
+        if (param == nullptr)
+            return;
+
+        if (isBool)
+        {
+            toggle.setButtonText(param->getName(64));
+            buttonAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(apvts, paramId, toggle);
+        }
+        else
+        {
+            slider.setName(param->getName(64));
+            sliderAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(apvts, paramId, slider);
+        }
+    }
+
+    void resized() override
+    {
+        auto area = getLocalBounds();
+        label.setBounds(area.removeFromTop(20).withWidth(200));
+        toggle.setBounds(area.withX(220).withWidth(200).withHeight(24));
+        slider.setBounds(area.withX(220).withWidth(juce::jmax(0, getWidth() - 220)).withHeight(32));
+    }
+
+private:
+    juce::Label label;
+    juce::ToggleButton toggle;
+    juce::Slider slider { juce::Slider::LinearHorizontal, juce::Slider::TextBoxRight };
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> buttonAttachment;
+    juce::String boundId;
+};
+
+class ParameterListModel : public juce::ListBoxModel
+{
+public:
+    ParameterListModel(juce::AudioProcessorValueTreeState& state, const juce::StringArray& ids) : apvts(state), paramIds(ids) {}
+
+    int getNumRows() override { return paramIds.size(); }
+
+    void paintListBoxItem(int, juce::Graphics&, int, int, bool) override {}
+
+    juce::Component* refreshComponentForRow(int row, bool, juce::Component* existing) override
+    {
+        auto* paramRow = dynamic_cast<ParameterRow*>(existing);
+
+        if (! juce::isPositiveAndBelow(row, paramIds.size()))
+        {
+            delete existing;
+            return nullptr;
+        }
+
+        if (paramRow == nullptr)
+        {
+            delete existing;
+            paramRow = new ParameterRow();
+        }
+
+        paramRow->bind(apvts, paramIds[row]);
+        return paramRow;
+    }
+
+private:
+    juce::AudioProcessorValueTreeState& apvts;
+    const juce::StringArray& paramIds;
+};
+
+// =============================================================================
+// Spectrum View
+//
+// Draws the analyzer's input (grey) and output (orange) spectra on a log
+// frequency axis, plus what the analyzer costs the audio thread per block.
+// =============================================================================
+class TheRocketAudioProcessorEditor::DeveloperPanel::SpectrumView : public juce::Component
+{
+public:
+    explicit SpectrumView(SpectrumAnalyzer& analyzerIn) : analyzer(analyzerIn)
+    {
+        setOpaque(true);
+        frameTimer.startTimerHz(30);
+    }
+
+    ~SpectrumView() override
+    {
+        analyzer.setEnabled(false);
+    }
+
+    void paint(juce::Graphics& g) override
+    {
+        const auto bounds = getLocalBounds().toFloat();
+        g.fillAll(juce::Colours::black);
+
+        g.setColour(juce::Colours::white.withAlpha(0.12f));
+        for (const float freq : { 100.0f, 1000.0f, 10000.0f })
+            g.drawVerticalLine(juce::roundToInt(frequencyToX(freq, bounds)), bounds.getY(), bounds.getBottom());
+        for (const float db : { -24.0f, -48.0f, -72.0f })
+            g.drawHorizontalLine(juce::roundToInt(dbToY(db, bounds)), bounds.getX(), bounds.getRight());
+
+        drawCurve(g, bounds, inputDb, juce::Colours::grey);
+        drawCurve(g, bounds, outputDb, juce::Colour::fromFloatRGBA(1.0f, 0.6f, 0.2f, 1.0f));
+
+        g.setColour(juce::Colour::fromFloatRGBA(0.8f, 0.8f, 0.9f, 1.0f));
+        g.setFont(11.0f);
+        g.drawText("in / out   analyzer " + juce::String(analyzer.getAudioThreadCostMicros(), 2) + " us/block",
+                   getLocalBounds().reduced(6, 2), juce::Justification::topRight);
+    }
+
+private:
+    static constexpr float kMinFrequency = 20.0f;
+    static constexpr float kMaxFrequency = 20000.0f;
+    static constexpr float kMinDb = -96.0f;
+
+    void tick()
+    {
+        analyzer.setEnabled(isShowing());
+        if (! analyzer.isEnabled())
+            return;
+
+        const bool hasInput = analyzer.getSpectrum(SpectrumAnalyzer::Tap::input, inputDb);
+        const bool hasOutput = analyzer.getSpectrum(SpectrumAnalyzer::Tap::output, outputDb);
+        if (hasInput || hasOutput)
+            repaint();
+    }
+
+    static float frequencyToX(float freq, juce::Rectangle<float> bounds)
+    {
+        const float norm = std::log(freq / kMinFrequency) / std::log(kMaxFrequency / kMinFrequency);
+        return bounds.getX() + norm * bounds.getWidth();
+    }
+
+    static float dbToY(float db, juce::Rectangle<float> bounds)
+    {
+        return juce::jmap(juce::jlimit(kMinDb, 0.0f, db), kMinDb, 0.0f, bounds.getBottom(), bounds.getY());
+    }
+
+    void drawCurve(juce::Graphics& g, juce::Rectangle<float> bounds, const std::vector<float>& magnitudesDb,
+                   juce::Colour colour) const
+    {
+        if (magnitudesDb.empty())
+            return;
+
+        const double binWidth = analyzer.getSampleRate() / (double) SpectrumAnalyzer::kFftSize;
+
+        juce::Path path;
+        for (size_t bin = 1; bin < magnitudesDb.size(); ++bin)
+        {
+            const float freq = (float) (binWidth * (double) bin);
+            if (freq < kMinFrequency)
+                continue;
+            if (freq > kMaxFrequency)
+                break;
+
+            const juce::Point<float> point { frequencyToX(freq, bounds), dbToY(magnitudesDb[bin], bounds) };
+            if (path.isEmpty())
+                path.startNewSubPath(point);
+            else
+                path.lineTo(point);
+        }
+
+        g.setColour(colour);
+        g.strokePath(path, juce::PathStrokeType(1.2f));
+    }
+
+    SpectrumAnalyzer& analyzer;
+    std::vector<float> inputDb;
+    std::vector<float> outputDb;
+    juce::TimedCallback frameTimer { [this] { tick(); } };
 };
 
 // =============================================================================
@@ -174,7 +555,8 @@ TheRocketAudioProcessorEditor::DeveloperPanel::DeveloperPanel(TheRocketAudioProc
     addAndMakeVisible(moduleLabel);
     addAndMakeVisible(moveUp);
     addAndMakeVisible(moveDown);
-    addAndMakeVisible(paramViewport);
+    addAndMakeVisible(paramHeader);
+    addAndMakeVisible(paramList);
     addAndMakeVisible(presetLabel);
     addAndMakeVisible(presetList);
     addAndMakeVisible(presetName);
@@ -192,13 +574,35 @@ TheRocketAudioProcessorEditor::DeveloperPanel::DeveloperPanel(TheRocketAudioProc
     addAndMakeVisible(modLabel);
     addAndMakeVisible(assignList);
 
-    paramViewport.setViewedComponent(&paramContent, false);
+    paramHeader.setText("FX Parameters", juce::dontSendNotification);
+    paramHeader.setColour(juce::Label::textColourId, juce::Colour::fromFloatRGBA(0.9f, 0.9f, 1.0f, 1.0f));
+    paramHeader.setFont(juce::Font(14.0f, juce::Font::bold));
+
+    paramModel.reset(new ParameterListModel(processor.getAPVTS(), paramRowIds));
+    paramList.setModel(paramModel.get());
+    paramList.setRowHeight(60);
+    paramList.setColour(juce::ListBox::backgroundColourId, juce::Colours::transparentBlack);
 
     model.reset(new ModuleListModel(processor, moduleList));
     moduleList.setModel(model.get());
 
-    assignModel.reset(new AssignmentListModel(processor, assignList));
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    moduleList.setRowHeight(34);
+    addAndMakeVisible(resetPeaks);
+    resetPeaks.onClick = [this] { processor.getFxChain().resetProfilingPeaks(); };
+#endif
+
+    addAndMakeVisible(telemetryLabel);
+    telemetryLabel.setColour(juce::Label::textColourId, juce::Colour::fromFloatRGBA(0.8f, 0.8f, 0.9f, 1.0f));
+    telemetryLabel.setFont(juce::Font(12.0f));
+    pollTimer.startTimerHz(10);
+
+    spectrumView = std::make_unique<SpectrumView>(processor.getSpectrumAnalyzer());
+    addAndMakeVisible(*spectrumView);
+
+    assignModel.reset(new AssignmentListModel(processor, assignList, telemetry));
     assignList.setModel(assignModel.get());
+    assignList.setMultipleSelectionEnabled(true);
 
     assignAmount.setSliderStyle(juce::Slider::LinearHorizontal);
     assignAmount.setTextBoxStyle(juce::Slider::TextBoxRight, false, 80, 20);
@@ -297,10 +701,16 @@ TheRocketAudioProcessorEditor::DeveloperPanel::DeveloperPanel(TheRocketAudioProc
 
     removeAssign.onClick = [this]
     {
-        int row = assignList.getSelectedRow();
-        if (row >= 0)
+        const auto rows = assignList.getSelectedRows();
+        if (!rows.isEmpty())
         {
-            processor.getModMatrix().removeAssignment(row);
+            // Remove highest rows first; the audio thread sees one commit for the whole selection
+            auto& modMatrix = processor.getModMatrix();
+            const ModMatrix::ScopedBatch batch(modMatrix);
+            for (int i = rows.size(); --i >= 0;)
+                modMatrix.removeAssignment(rows[i]);
+
+            assignList.deselectAllRows();
             assignList.updateContent();
         }
     };
@@ -373,85 +783,59 @@ void TheRocketAudioProcessorEditor::DeveloperPanel::saveCurrentAsName(const juce
 
 void TheRocketAudioProcessorEditor::DeveloperPanel::rebuildParameterUI()
 {
-    sliders.clear();
-    toggles.clear();
-    sliderAttachments.clear();
-    buttonAttachments.clear();
-    paramContent.removeAllChildren();
-
     auto& apvts = processor.getAPVTS();
-    int y = 0;
+    paramRowIds.clear();
 
-    auto* headerLabel = new juce::Label();
-    headerLabel->setText("FX Parameters", juce::dontSendNotification);
-    headerLabel->setColour(juce::Label::textColourId, juce::Colour::fromFloatRGBA(0.9f, 0.9f, 1.0f, 1.0f));
-    headerLabel->setFont(juce::Font(14.0f, juce::Font::bold));
-    paramContent.addAndMakeVisible(headerLabel);
-    headerLabel->setBounds(0, y, 450, 25);
-    y += 30;
+    for (const auto& id : processor.getParameterIDs())
+        if (id != "amount" && apvts.getParameter(id) != nullptr)
+            paramRowIds.add(id);
 
-    auto ids = processor.getParameterIDs();
-    for (int i = 0; i < ids.size(); ++i)
-    {
-        auto id = ids[i];
-        if (id == "amount")
-            continue;
+    paramList.updateContent();
+    paramList.repaint();
+}
 
-        auto* param = apvts.getParameter(id);
-        if (param == nullptr)
-            continue;
+void TheRocketAudioProcessorEditor::DeveloperPanel::rebuildModuleList()
+{
+    moduleList.updateContent();
+}
+
+void TheRocketAudioProcessorEditor::DeveloperPanel::poll()
+{
+    refreshTelemetry();
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    refreshProfiling();
+#endif
+}
 
-        auto* paramLabel = new juce::Label();
-        paramLabel->setText(param->getName(64), juce::dontSendNotification);
-        paramLabel->setColour(juce::Label::textColourId, juce::Colour::fromFloatRGBA(0.8f, 0.8f, 0.9f, 1.0f));
-        paramLabel->setFont(juce::Font(12.0f));
-        paramContent.addAndMakeVisible(paramLabel);
-        paramLabel->setBounds(0, y, 200, 20);
-        y += 25;
+void TheRocketAudioProcessorEditor::DeveloperPanel::refreshTelemetry()
+{
+    telemetry = processor.getTelemetry();
 
-        if (auto* boolParam = dynamic_cast<juce::AudioParameterBool*>(param))
-        {
-            auto* t = new juce::ToggleButton(boolParam->name);
-            t->setColour(juce::ToggleButton::tickColourId, juce::Colour::fromFloatRGBA(1.0f, 0.6f, 0.2f, 1.0f));
-            t->setColour(juce::ToggleButton::tickDisabledColourId, juce::Colour::fromFloatRGBA(0.5f, 0.5f, 0.5f, 1.0f));
-            t->setColour(juce::ToggleButton::textColourId, juce::Colour::fromFloatRGBA(0.9f, 0.9f, 1.0f, 1.0f));
-            
-            toggles.add(t);
-            paramContent.addAndMakeVisible(t);
-            buttonAttachments.add(new juce::AudioProcessorValueTreeState::ButtonAttachment(apvts, id, *t));
-            t->setBounds(220, y - 5, 200, 24);
-            y += 35;
-        }
-        else
-        {
-            auto* s = new juce::Slider(juce::Slider::LinearHorizontal, juce::Slider::TextBoxRight);
-            s->setColour(juce::Slider::backgroundColourId, juce::Colour::fromFloatRGBA(0.2f, 0.2f, 0.3f, 1.0f));
-            s->setColour(juce::Slider::trackColourId, juce::Colour::fromFloatRGBA(0.4f, 0.4f, 0.5f, 1.0f));
-            s->setColour(juce::Slider::rotarySliderFillColourId, juce::Colour::fromFloatRGBA(1.0f, 0.6f, 0.2f, 1.0f));
-            s->setColour(juce::Slider::rotarySliderOutlineColourId, juce::Colour::fromFloatRGBA(0.8f, 0.8f, 0.9f, 1.0f));
-            s->setColour(juce::Slider::thumbColourId, juce::Colour::fromFloatRGBA(0.9f, 0.9f, 1.0f, 1.0f));
-            s->setColour(juce::Slider::textBoxTextColourId, juce::Colour::fromFloatRGBA(0.9f, 0.9f, 1.0f, 1.0f));
-            s->setColour(juce::Slider::textBoxBackgroundColourId, juce::Colour::fromFloatRGBA(0.3f, 0.3f, 0.4f, 1.0f));
-            s->setColour(juce::Slider::textBoxOutlineColourId, juce::Colour::fromFloatRGBA(0.6f, 0.6f, 0.7f, 1.0f));
-            
-            s->setTextValueSuffix(" ");
-            s->setName(param->getName(64));
-            sliders.add(s);
-            paramContent.addAndMakeVisible(s);
-            sliderAttachments.add(new juce::AudioProcessorValueTreeState::SliderAttachment(apvts, id, *s));
-
-            s->setBounds(220, y - 5, 420, 32);
-            y += 40;
-        }
-    }
+    auto toDb = [] (float gain) { return juce::String(juce::Decibels::gainToDecibels(gain, -100.0f), 1); };
 
-    paramContent.setSize(450, y + 20);
+    juce::String text = "Amount " + juce::String(telemetry.smoothedAmount, 3);
+    for (int ch = 0; ch < telemetry.numChannels; ++ch)
+        text << "   " << (ch == 0 ? "L " : "R ") << toDb(telemetry.peak[(size_t)ch]) << " / "
+             << toDb(telemetry.rms[(size_t)ch]) << " dB";
+    text << "   targets " << telemetry.numTargets;
+
+    telemetryLabel.setText(text, juce::dontSendNotification);
+
+    if (telemetry.numTargets > 0)
+        assignList.repaint();
 }
 
-void TheRocketAudioProcessorEditor::DeveloperPanel::rebuildModuleList()
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+void TheRocketAudioProcessorEditor::DeveloperPanel::refreshProfiling()
 {
-    moduleList.updateContent();
+    const auto chain = processor.getFxChain().getChainStats();
+    const double percent = chain.budgetMicros > 0.0 ? 100.0 * chain.averageMicros / chain.budgetMicros : 0.0;
+
+    moduleLabel.setText("FX Chain  " + juce::String(chain.averageMicros, 1) + " us  " + juce::String(percent, 1) + "%",
+                        juce::dontSendNotification);
+    moduleList.repaint();
 }
+#endif
 
 void TheRocketAudioProcessorEditor::DeveloperPanel::resized()
 {
@@ -484,6 +868,9 @@ void TheRocketAudioProcessorEditor::DeveloperPanel::resized()
     auto btnArea = leftPanel.removeFromTop(40);
     moveUp.setBounds(btnArea.removeFromLeft(90).reduced(2));
     moveDown.setBounds(btnArea.removeFromLeft(90).reduced(2));
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+    resetPeaks.setBounds(btnArea.reduced(2));
+#endif
     
     // Modulation mapping section
     auto modSection = leftPanel;
@@ -504,7 +891,10 @@ void TheRocketAudioProcessorEditor::DeveloperPanel::resized()
     assignList.setBounds(modSection);
 
     // Parameter controls section
-    paramViewport.setBounds(rightPanel);
+    telemetryLabel.setBounds(rightPanel.removeFromTop(22));
+    spectrumView->setBounds(rightPanel.removeFromTop(140).reduced(0, 2));
+    paramHeader.setBounds(rightPanel.removeFromTop(25));
+    paramList.setBounds(rightPanel.withTrimmedTop(5));
 }
 
 // =============================================================================
@@ -514,11 +904,6 @@ TheRocketAudioProcessorEditor::TheRocketAudioProcessorEditor (TheRocketAudioProc
     : AudioProcessorEditor (&p), processor (p)
 {
     DBG("TheRocketAudioProcessorEditor constructor called");
-    backgroundImg = juce::ImageCache::getFromMemory(BinaryData::ui_background_png, BinaryData::ui_background_pngSize);
-    cloudsImg = juce::ImageCache::getFromMemory(BinaryData::ui_clouds_png, BinaryData::ui_clouds_pngSize);
-    panelImg = juce::ImageCache::getFromMemory(BinaryData::ui_panel_png, BinaryData::ui_panel_pngSize);
-    rocketImg = juce::ImageCache::getFromMemory(BinaryData::ui_rocket_png, BinaryData::ui_rocket_pngSize);
-    flameImg = juce::ImageCache::getFromMemory(BinaryData::ui_flame_png, BinaryData::ui_flame_pngSize);
 
     setLookAndFeel(&rocketLnf);
 
@@ -605,16 +990,7 @@ TheRocketAudioProcessorEditor::TheRocketAudioProcessorEditor (TheRocketAudioProc
         resized();
     };
 
-    if (backgroundImg.isValid())
-    {
-        DBG("Background image valid, setting size to " + juce::String(backgroundImg.getWidth()) + " x " + juce::String(backgroundImg.getHeight()));
-        setSize(600, 900);
-    }
-    else
-    {
-        DBG("Using default portrait size 600x900");
-        setSize(600, 900);
-    }
+    setSize(600, 900);
 
     // Resizable portrait UI with fixed aspect ratio
     boundsConstrainer.setFixedAspectRatio(600.0 / 900.0);
@@ -629,11 +1005,14 @@ TheRocketAudioProcessorEditor::TheRocketAudioProcessorEditor (TheRocketAudioProc
     setOpaque(true);
     toFront(true);
 
-    uiAmountSmoothed.reset(60.0, 0.12);
-    uiAmountSmoothed.setCurrentAndTargetValue(processor.getAPVTS().getRawParameterValue("amount")->load());
-    
-    // Start a timer to continuously repaint for animation
-    startTimer(16); // ~60 FPS
+    amountValue = processor.getAPVTS().getRawParameterValue("amount");
+    uiAmountSmoothed.reset(1000.0, 0.12);
+    uiAmountSmoothed.setCurrentAndTargetValue(amountValue->load());
+
+    // Dragging the knob wakes the animation immediately; everything else is caught by the idle poll
+    amountKnob.onValueChange = [this] { startAnimation(); };
+    adoptAssets(); // once sized, so the right artwork variants are prepared
+    startTimerHz(kIdlePollHz);
     
     DBG("TheRocketAudioProcessorEditor constructor finished, size: " + juce::String(getWidth()) + "x" + juce::String(getHeight()));
 }
@@ -645,121 +1024,191 @@ TheRocketAudioProcessorEditor::~TheRocketAudioProcessorEditor()
 
 void TheRocketAudioProcessorEditor::paint (juce::Graphics& g)
 {
-    g.setImageResamplingQuality(juce::Graphics::highResamplingQuality);
-    g.fillAll(juce::Colours::black);
-    
-    // Draw background without aspect distortion (cropped if needed)
-    if (backgroundImg.isValid())
-    {
-        g.drawImageWithin(backgroundImg, 0, 0, getWidth(), getHeight(), juce::RectanglePlacement::fillDestination);
-    }
+    ROCKET_TRACE_SCOPE("Editor::paint");
+
+    // Cached layers are rendered at device resolution; rebuild if the window moved to a display
+    // with a different scale since the last resized().
+    const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (pixelScale != renderCache.pixelScale || renderCache.bounds != getLocalBounds())
+        rebuildRenderCache(pixelScale);
+
+    const auto unscale = juce::AffineTransform::scale(1.0f / renderCache.pixelScale);
+
+    // Background (static)
+    if (renderCache.backdrop.isValid())
+        g.drawImageTransformed(renderCache.backdrop, unscale);
+    else
+        g.fillAll(juce::Colours::black);
 
     // Get the current knob value (0.0 to 1.0)
     const float knobValue = juce::jlimit(0.0f, 1.0f, uiAmountSmoothed.getCurrentValue());
 
     const auto layout = makeMainLayout(getLocalBounds(), panelImg);
+    const auto sprites = makeSpriteLayout(layout, getWidth(), knobValue, cloudsImg, rocketImg.isValid(), flameImg.isValid());
 
+    // Moving sprites, pre-scaled in rebuildRenderCache()
     {
         juce::Graphics::ScopedSaveState state(g);
         g.reduceClipRegion(layout.animationArea);
 
-        // Draw clouds - keep correct aspect ratio
-        if (cloudsImg.isValid())
+        if (renderCache.cloud.isValid())
         {
-            const float cloudAspect = (float) cloudsImg.getWidth() / (float) cloudsImg.getHeight();
-            const int cloudW = juce::roundToInt(190.0f * layout.scale);
-            const int cloudH = juce::roundToInt(cloudW / cloudAspect);
+            for (size_t i = 0; i < sprites.clouds.size(); ++i)
+            {
+                g.setOpacity(kCloudOpacities[i]);
+                g.drawImageTransformed(renderCache.cloud, unscale.translated(sprites.clouds[i].getPosition()));
+            }
+        }
 
-            const float topBand = (float) juce::roundToInt(28.0f * layout.scale);
+        if (renderCache.rocket.isValid())
+        {
+            g.setOpacity(1.0f);
+            g.drawImageTransformed(renderCache.rocket, unscale.translated(sprites.rocket.getPosition()));
+        }
 
-            // Cloud 1 - left
-            const float c1x = 22.0f * layout.scale + knobValue * 18.0f * layout.scale;
-            const float c1y = topBand + 40.0f * layout.scale - knobValue * 60.0f * layout.scale;
-            g.setOpacity(0.85f);
-            g.drawImage(cloudsImg, juce::roundToInt(c1x), juce::roundToInt(c1y), cloudW, cloudH, 0, 0, cloudsImg.getWidth(),
-                        cloudsImg.getHeight());
+        // The flame grows with Amount, so it is cached at its largest size and only ever scaled down
+        if (renderCache.flame.isValid() && ! sprites.flame.isEmpty())
+        {
+            g.setImageResamplingQuality(juce::Graphics::mediumResamplingQuality);
+            g.setOpacity(sprites.flameOpacity);
+            g.drawImage(renderCache.flame, sprites.flame.getX(), sprites.flame.getY(), sprites.flame.getWidth(),
+                        sprites.flame.getHeight(), 0, 0, renderCache.flame.getWidth(), renderCache.flame.getHeight());
+        }
+    }
 
-            // Cloud 2 - center
-            const float c2x = (float) (getWidth() / 2 - cloudW / 2) + knobValue * 25.0f * layout.scale;
-            const float c2y = topBand + 12.0f * layout.scale - knobValue * 72.0f * layout.scale;
-            g.setOpacity(0.80f);
-            g.drawImage(cloudsImg, juce::roundToInt(c2x), juce::roundToInt(c2y), cloudW, cloudH, 0, 0, cloudsImg.getWidth(),
-                        cloudsImg.getHeight());
+    // Panel shade and panel art (static)
+    if (renderCache.overlay.isValid())
+    {
+        g.setOpacity(1.0f);
+        g.drawImageTransformed(renderCache.overlay, unscale.translated(0.0f, (float) renderCache.overlayTop));
+    }
+}
 
-            // Cloud 3 - right
-            const float c3x = (float) (getWidth() - cloudW) - 22.0f * layout.scale - knobValue * 20.0f * layout.scale;
-            const float c3y = topBand + 68.0f * layout.scale - knobValue * 56.0f * layout.scale;
-            g.setOpacity(0.85f);
-            g.drawImage(cloudsImg, juce::roundToInt(c3x), juce::roundToInt(c3y), cloudW, cloudH, 0, 0, cloudsImg.getWidth(),
-                        cloudsImg.getHeight());
-        }
+void TheRocketAudioProcessorEditor::rebuildRenderCache(float pixelScale)
+{
+    renderCache = {};
+    renderCache.pixelScale = juce::jmax(0.25f, pixelScale);
+    renderCache.bounds = getLocalBounds();
 
-        const float topMargin = 40.0f * layout.scale;
-        const float padOffset = 18.0f * layout.scale;
+    if (getWidth() <= 0 || getHeight() <= 0)
+        return;
 
-        float rocketY = 0.0f;
-        int rocketW = 0;
-        int rocketH = 0;
+    const float s = renderCache.pixelScale;
+    const auto layout = makeMainLayout(getLocalBounds(), panelImg);
 
-        // Draw rocket - launches upward from above the panel
-        if (rocketImg.isValid())
-        {
-            // Crop transparent padding from the source art for consistent sizing.
-            const juce::Rectangle<int> rocketSrc { 36, 47, 54, 206 };
-            const float rocketAspect = (float) rocketSrc.getWidth() / (float) rocketSrc.getHeight();
-            rocketH = juce::roundToInt(120.0f * layout.scale);
-            rocketW = juce::roundToInt((float) rocketH * rocketAspect);
+    // Artwork at device resolution, normally built ahead on the asset cache's loader thread (see adoptAssets())
+    const auto plan = planArtwork(getLocalBounds(), s, backgroundImg, panelImg, cloudsImg, rocketImg.isValid(), flameImg.isValid());
+    auto scaledArt = [this, &plan] (UiAssetCache::Asset asset) { return assets->getScaled(plan.requests[(size_t) asset]); };
 
-            const float maxLift = juce::jmax(0.0f, (float) layout.animationArea.getHeight() - topMargin - (float) rocketH - padOffset);
-            const float baseY = (float) layout.animationArea.getHeight() - padOffset - (float) rocketH;
-            rocketY = baseY - knobValue * knobValue * maxLift;
+    // Background
+    {
+        renderCache.backdrop = juce::Image(juce::Image::RGB, juce::roundToInt((float) getWidth() * s),
+                                           juce::roundToInt((float) getHeight() * s), false);
+        juce::Graphics g(renderCache.backdrop);
+        g.fillAll(juce::Colours::black);
 
-            g.setOpacity(1.0f);
-            g.drawImage(rocketImg, getWidth() / 2 - rocketW / 2, juce::roundToInt(rocketY), rocketW, rocketH, rocketSrc.getX(),
-                        rocketSrc.getY(), rocketSrc.getWidth(), rocketSrc.getHeight());
-        }
+        if (backgroundImg.isValid())
+            g.drawImageAt(scaledArt(UiAssetCache::Asset::background), plan.backgroundOrigin.x, plan.backgroundOrigin.y);
+    }
+
+    // Darken panel area subtly (helps controls read on bright backgrounds), then the panel itself
+    {
+        renderCache.overlayTop = juce::jmax(0, layout.panel.getY() - juce::roundToInt(80.0f * layout.scale));
+        const int overlayH = getHeight() - renderCache.overlayTop;
 
-        // Draw animated flame - anchored under the rocket (stays clipped above the panel)
-        if (flameImg.isValid() && rocketImg.isValid() && knobValue > 0.03f && rocketH > 0)
+        if (overlayH > 0)
         {
-            const juce::Rectangle<int> flameSrc { 7, 231, 106, 314 };
-            const float flameAspect = (float) flameSrc.getWidth() / (float) flameSrc.getHeight();
-            const float intensity = juce::jlimit(0.0f, 1.0f, (knobValue - 0.03f) / 0.97f);
+            renderCache.overlay = juce::Image(juce::Image::ARGB, juce::roundToInt((float) getWidth() * s),
+                                              juce::roundToInt((float) overlayH * s), true);
+            juce::Graphics g(renderCache.overlay);
 
-            const float flameScale = 0.65f + intensity * 0.95f;
-            const int flameH = juce::roundToInt((float) rocketH * 1.15f * flameScale);
-            const int flameW = juce::roundToInt((float) flameH * flameAspect);
+            {
+                juce::Graphics::ScopedSaveState state(g);
+                g.addTransform(juce::AffineTransform::scale(s).translated(0.0f, (float) -renderCache.overlayTop * s));
 
-            const float overlap = (float) rocketH * 0.10f;
-            const float flameY = rocketY + (float) rocketH - overlap;
+                juce::ColourGradient grad(juce::Colours::transparentBlack, 0.0f, (float) renderCache.overlayTop,
+                                          juce::Colours::black.withAlpha(0.72f), 0.0f, (float) layout.panel.getBottom(), false);
+                g.setGradientFill(grad);
+                g.fillRect(0, renderCache.overlayTop, getWidth(), overlayH);
+            }
 
-            g.setOpacity(0.65f + intensity * 0.35f);
-            g.drawImage(flameImg, getWidth() / 2 - flameW / 2, juce::roundToInt(flameY), flameW, flameH, flameSrc.getX(),
-                        flameSrc.getY(), flameSrc.getWidth(), flameSrc.getHeight());
+            if (panelImg.isValid())
+            {
+                g.setOpacity(1.0f);
+                g.drawImageAt(scaledArt(UiAssetCache::Asset::panel), juce::roundToInt((float) layout.panel.getX() * s),
+                              juce::roundToInt((float) (layout.panel.getY() - renderCache.overlayTop) * s));
+            }
         }
     }
 
-    // Darken panel area subtly (helps controls read on bright backgrounds)
-    {
-        const auto fadeTop = juce::jmax(0, layout.panel.getY() - juce::roundToInt(80.0f * layout.scale));
-        juce::ColourGradient grad(juce::Colours::transparentBlack, 0.0f, (float) fadeTop,
-                                  juce::Colours::black.withAlpha(0.72f), 0.0f, (float) layout.panel.getBottom(), false);
-        g.setGradientFill(grad);
-        g.fillRect(0, fadeTop, getWidth(), getHeight() - fadeTop);
-    }
+    renderCache.cloud = scaledArt(UiAssetCache::Asset::clouds);
+    renderCache.rocket = scaledArt(UiAssetCache::Asset::rocket);
+    renderCache.flame = scaledArt(UiAssetCache::Asset::flame);
+}
 
-    if (panelImg.isValid())
-    {
-        g.setOpacity(1.0f);
-        g.drawImage(panelImg, layout.panel.getX(), layout.panel.getY(), layout.panel.getWidth(), layout.panel.getHeight(), 0, 0,
-                    panelImg.getWidth(), panelImg.getHeight());
-    }
+// Picks up the decoded artwork once the shared cache has it; the first editor may open before that.
+void TheRocketAudioProcessorEditor::adoptAssets()
+{
+    if (assetsAdopted || ! assets->isReady())
+        return;
+
+    const auto background = assets->getImage(UiAssetCache::Asset::background);
+    const auto clouds = assets->getImage(UiAssetCache::Asset::clouds);
+    const auto panel = assets->getImage(UiAssetCache::Asset::panel);
+    const auto rocket = assets->getImage(UiAssetCache::Asset::rocket);
+    const auto flame = assets->getImage(UiAssetCache::Asset::flame);
+
+    // Have the loader thread resample the artwork for this size at every display's scale, and keep
+    // drawing without it until that is done (polled from timerCallback), so the first paint only
+    // blits. Other sizes and scales are resampled by paint() when they come up.
+    std::vector<float> pixelScales { getApproximateScaleFactorForComponent(this) };
+    for (const auto& display : juce::Desktop::getInstance().getDisplays().displays)
+        pixelScales.push_back((float) display.scale * juce::Desktop::getInstance().getGlobalScaleFactor());
+
+    std::vector<UiAssetCache::ScaledRequest> requests;
+    for (const auto pixelScale : pixelScales)
+        for (const auto& request : planArtwork(getLocalBounds(), juce::jmax(0.25f, pixelScale), background, panel, clouds,
+                                               rocket.isValid(), flame.isValid()).requests)
+            requests.push_back(request);
+
+    if (! assets->prepareScaled(requests))
+        return;
+
+    backgroundImg = background;
+    cloudsImg = clouds;
+    panelImg = panel;
+    rocketImg = rocket;
+    flameImg = flame;
+    assetsAdopted = true;
+
+    renderCache = {};
+    resized();
+    repaint();
+}
+
+// Area touched by the moving sprites, in editor coordinates
+juce::Rectangle<int> TheRocketAudioProcessorEditor::getSpriteBounds(float knobValue) const
+{
+    const auto layout = makeMainLayout(getLocalBounds(), panelImg);
+    const auto sprites = makeSpriteLayout(layout, getWidth(), juce::jlimit(0.0f, 1.0f, knobValue), cloudsImg,
+                                          rocketImg.isValid(), flameImg.isValid());
+
+    auto area = sprites.rocket.getUnion(sprites.flame);
+    for (const auto& cloud : sprites.clouds)
+        area = area.getUnion(cloud);
+
+    // One pixel of slack for rounding and resampling at fractional display scales
+    return area.expanded(1).getIntersection(layout.animationArea);
 }
 
 void TheRocketAudioProcessorEditor::resized()
 {
     auto area = getLocalBounds();
 
+    // Only invalidate: paint() rebuilds once, at the context's physical pixel scale (which includes
+    // the display scale that getApproximateScaleFactorForComponent() leaves out)
+    renderCache.pixelScale = 0.0f;
+
     if (resizer)
     {
         resizer->setBounds(getLocalBounds().removeFromBottom(18).removeFromRight(18));
@@ -855,8 +1304,49 @@ void TheRocketAudioProcessorEditor::loadPresetFromIndex(int index)
 
 void TheRocketAudioProcessorEditor::timerCallback()
 {
-    const float amountTarget = processor.getAPVTS().getRawParameterValue("amount")->load();
-    uiAmountSmoothed.setTargetValue(amountTarget);
-    uiAmountSmoothed.getNextValue();
-    repaint();
+    adoptAssets();
+
+    // Released here rather than from inside its own callback
+    if (animationSettled)
+    {
+        vblankAttachment.reset();
+        animationSettled = false;
+    }
+
+    if (vblankAttachment == nullptr && amountValue->load() != uiAmountSmoothed.getTargetValue())
+        startAnimation();
+}
+
+void TheRocketAudioProcessorEditor::startAnimation()
+{
+    if (vblankAttachment != nullptr && ! animationSettled)
+        return;
+
+    animationSettled = false;
+    lastFrameTime = 0.0;
+
+    if (vblankAttachment == nullptr)
+        vblankAttachment = std::make_unique<juce::VBlankAttachment>(this, [this] (double timestampSec) { onVBlank(timestampSec); });
+}
+
+void TheRocketAudioProcessorEditor::onVBlank(double timestampSec)
+{
+    if (animationSettled)
+        return;
+
+    uiAmountSmoothed.setTargetValue(amountValue->load());
+
+    // Advance by real elapsed time so the motion is the same at any refresh rate
+    const int elapsedMs = lastFrameTime > 0.0 ? juce::jlimit(0, 100, juce::roundToInt((timestampSec - lastFrameTime) * 1000.0)) : 16;
+    lastFrameTime = timestampSec;
+
+    const float previous = uiAmountSmoothed.getCurrentValue();
+    const float current = uiAmountSmoothed.skip(elapsedMs);
+
+    // Only the sprites move; repaint where they were and where they are now
+    if (current != previous && isShowing())
+        repaint(getSpriteBounds(previous).getUnion(getSpriteBounds(current)));
+
+    if (! uiAmountSmoothed.isSmoothing())
+        animationSettled = true;
 }
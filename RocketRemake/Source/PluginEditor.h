@@ -3,6 +3,7 @@
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
 #include "LookAndFeel/RocketLookAndFeel.h"
+#include "UiAssetCache.h"
 
 class TheRocketAudioProcessorEditor : public juce::AudioProcessorEditor, public juce::Timer
 {
@@ -17,13 +18,48 @@ public:
 private:
     TheRocketAudioProcessor& processor;
     RocketLookAndFeel rocketLnf;
+
+    // Artwork decoded once and kept alive by the processor; the images below are shared with every other editor
+    juce::SharedResourcePointer<UiAssetCache> assets;
+    bool assetsAdopted = false;
+    void adoptAssets();
+
     juce::Image backgroundImg;
     juce::Image cloudsImg;
     juce::Image panelImg;
     juce::Image rocketImg;
     juce::Image flameImg;
 
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> uiAmountSmoothed;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> uiAmountSmoothed; // stepped in milliseconds
+    std::atomic<float>* amountValue = nullptr;
+
+    // Animation runs on display vblanks only while Amount is moving; the timer is a slow idle
+    // poll that restarts it when the parameter changes (automation, host, preset load).
+    static constexpr int kIdlePollHz = 15;
+    std::unique_ptr<juce::VBlankAttachment> vblankAttachment;
+    double lastFrameTime = 0.0;
+    bool animationSettled = false;
+
+    void startAnimation();
+    void onVBlank(double timestampSec);
+
+    // Static layers and sprites pre-rendered at device resolution for the current size
+    struct RenderCache
+    {
+        float pixelScale = 0.0f;
+        juce::Rectangle<int> bounds;
+        juce::Image backdrop;      // background, full window
+        juce::Image overlay;       // panel shade and panel art, from overlayTop down
+        int overlayTop = 0;
+        juce::Image cloud;
+        juce::Image rocket;
+        juce::Image flame;         // at its largest size
+    };
+
+    RenderCache renderCache;
+
+    void rebuildRenderCache(float pixelScale);
+    juce::Rectangle<int> getSpriteBounds(float knobValue) const;
 
     juce::ComponentBoundsConstrainer boundsConstrainer;
     std::unique_ptr<juce::ResizableCornerComponent> resizer;
@@ -40,6 +76,7 @@ private:
     {
     public:
         explicit DeveloperPanel(TheRocketAudioProcessorEditor& editorIn);
+        ~DeveloperPanel() override;
         void resized() override;
         void rebuildParameterUI();
 
@@ -60,12 +97,11 @@ private:
         juce::TextButton presetSaveAs { "Save As" };
         juce::TextButton presetDelete { "Delete" };
 
-        juce::Viewport paramViewport;
-        juce::Component paramContent;
-        juce::OwnedArray<juce::Slider> sliders;
-        juce::OwnedArray<juce::ToggleButton> toggles;
-        juce::OwnedArray<juce::AudioProcessorValueTreeState::SliderAttachment> sliderAttachments;
-        juce::OwnedArray<juce::AudioProcessorValueTreeState::ButtonAttachment> buttonAttachments;
+        // Parameter editor: a virtualised list, rows are created and bound only while visible
+        juce::Label paramHeader;
+        juce::ListBox paramList;
+        juce::StringArray paramRowIds;
+        std::unique_ptr<juce::ListBoxModel> paramModel;
 
         juce::ComboBox assignParam;
         juce::Slider assignAmount;
@@ -83,6 +119,24 @@ private:
         void saveCurrentAsName(const juce::String& name);
 
         void rebuildModuleList();
+
+        // Audio-thread telemetry (levels, Amount, effective ModMatrix targets), polled a few times a second
+        juce::Label telemetryLabel;
+        TelemetryFrame telemetry;
+        void refreshTelemetry();
+
+#if defined(ROCKET_PROFILING) && ROCKET_PROFILING
+        // Per-module CPU time shown in the module list
+        juce::TextButton resetPeaks { "Reset Peaks" };
+        void refreshProfiling();
+#endif
+
+        // Input/output spectrum; the analyzer only runs while this view is on screen
+        class SpectrumView;
+        std::unique_ptr<SpectrumView> spectrumView;
+
+        juce::TimedCallback pollTimer { [this] { poll(); } };
+        void poll();
     };
 
     juce::ToggleButton devToggle { "Internal" };
@@ -12,6 +12,9 @@ TheRocketAudioProcessor::TheRocketAudioProcessor()
 {
     // Build parameter ID list
     FxChain::addParameterIDs(paramIDs);
+
+    amountParam = { apvts, "amount" };
+    globalMixParam = { apvts, "global_mix" };
 }
 
 TheRocketAudioProcessor::~TheRocketAudioProcessor() = default;
@@ -36,7 +39,7 @@ const juce::String TheRocketAudioProcessor::getName() const { return JucePlugin_
 bool TheRocketAudioProcessor::acceptsMidi() const { return false; }
 bool TheRocketAudioProcessor::producesMidi() const { return false; }
 bool TheRocketAudioProcessor::isMidiEffect() const { return false; }
-double TheRocketAudioProcessor::getTailLengthSeconds() const { return 2.0; }
+double TheRocketAudioProcessor::getTailLengthSeconds() const { return ReverbModule::getMaxTailSeconds(); }
 int TheRocketAudioProcessor::getNumPrograms() { return 1; }
 int TheRocketAudioProcessor::getCurrentProgram() { return 0; }
 void TheRocketAudioProcessor::setCurrentProgram(int) {}
@@ -54,6 +57,7 @@ void TheRocketAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     modMatrix.prepare(sampleRate, samplesPerBlock);
 
     dryBuffer.setSize(getTotalNumOutputChannels(), samplesPerBlock);
+    spectrumAnalyzer.prepare(sampleRate, samplesPerBlock);
 
     amountSmoothed.reset(sampleRate, 0.05); // 50ms smoothing
     globalMixSmoothed.reset(sampleRate, 0.02); // 20ms smoothing
@@ -79,6 +83,7 @@ bool TheRocketAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts)
 
 void TheRocketAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
 {
+    ROCKET_TRACE_SCOPE("processBlock");
     juce::ScopedNoDenormals noDenormals;
 
     const int totalNumInputChannels = getTotalNumInputChannels();
@@ -90,17 +95,18 @@ void TheRocketAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
         buffer.clear(i, 0, numSamples);
 
     // Get current Amount value
-    const float amountTarget = apvts.getRawParameterValue("amount")->load();
+    const float amountTarget = amountParam.load(0.0f);
     amountSmoothed.setTargetValue(amountTarget);
 
     // Get global mix
     float globalMixTarget = 1.0f;
-    if (auto* p = apvts.getRawParameterValue("global_mix"))
-        globalMixTarget = modMatrix.getModulatedParamValue("global_mix", p->load());
+    if (globalMixParam.value != nullptr)
+        globalMixTarget = modMatrix.getModulatedParamValue(globalMixParam.index, globalMixParam.value->load());
     globalMixSmoothed.setTargetValue(globalMixTarget);
 
     // Copy dry signal for mix
     dryBuffer.makeCopyOf(buffer, true);
+    spectrumAnalyzer.push(SpectrumAnalyzer::Tap::input, buffer);
 
     // Get transport info for sync
     FxTransportInfo transport;
@@ -117,10 +123,7 @@ void TheRocketAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     }
     transport.sampleRate = getSampleRate();
 
-    // Update macro value
-    modMatrix.setMacroValue(amountSmoothed.getCurrentValue());
-
-    // Process FX chain
+    // Process FX chain (advances amountSmoothed per control sub-block)
     fxChain.process(buffer, amountSmoothed, modMatrix, transport);
 
     // Apply global mix (dry/wet)
@@ -168,15 +171,42 @@ void TheRocketAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
         presetPopGuardSamples.store(remaining - toProcess, std::memory_order_release);
     }
 
-    // Advance smoother
-    for (int i = 0; i < numSamples; ++i)
-        amountSmoothed.getNextValue();
+    spectrumAnalyzer.push(SpectrumAnalyzer::Tap::output, buffer);
+    publishTelemetry(buffer);
+}
+
+void TheRocketAudioProcessor::publishTelemetry(const juce::AudioBuffer<float>& buffer)
+{
+    auto& frame = telemetryFrame;
+    const int numSamples = buffer.getNumSamples();
+
+    ++frame.blockCounter;
+    frame.smoothedAmount = amountSmoothed.getCurrentValue();
+
+    frame.numChannels = juce::jmin(buffer.getNumChannels(), TelemetryFrame::kMaxChannels);
+    for (int ch = 0; ch < frame.numChannels; ++ch)
+    {
+        frame.peak[(size_t)ch] = buffer.getMagnitude(ch, 0, numSamples);
+        frame.rms[(size_t)ch] = buffer.getRMSLevel(ch, 0, numSamples);
+    }
+
+    frame.numTargets = 0;
+    modMatrix.forEachModulatedTarget([&frame] (int paramIndex, float value)
+    {
+        if (frame.numTargets < TelemetryFrame::kMaxTargets)
+            frame.targets[(size_t)frame.numTargets++] = { paramIndex, value };
+    });
+
+    telemetry.store(frame);
 }
 
 bool TheRocketAudioProcessor::hasEditor() const { return true; }
 
 juce::AudioProcessorEditor* TheRocketAudioProcessor::createEditor()
 {
+    if (uiAssets == nullptr)
+        uiAssets = std::make_unique<juce::SharedResourcePointer<UiAssetCache>>();
+
     return new TheRocketAudioProcessorEditor(*this);
 }
 
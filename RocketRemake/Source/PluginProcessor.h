@@ -3,7 +3,11 @@
 #include <JuceHeader.h>
 #include "DSP/FxChain.h"
 #include "DSP/ModMatrix.h"
+#include "DSP/Telemetry.h"
+#include "DSP/SpectrumAnalyzer.h"
 #include "PresetManager.h"
+#include "UiAssetCache.h"
+#include "Diagnostics/TraceRecorder.h"
 #include <atomic>
 
 class TheRocketAudioProcessor : public juce::AudioProcessor
@@ -45,7 +49,11 @@ public:
     FxChain& getFxChain() { return fxChain; }
     const juce::StringArray& getParameterIDs() const { return paramIDs; }
 
-    float getSmoothedAmount() const { return amountSmoothed.getCurrentValue(); }
+    // Any thread: the latest per-block telemetry published by processBlock.
+    TelemetryFrame getTelemetry() const noexcept { return telemetry.load(); }
+
+    // Input/output spectra for the developer panel; idle unless enabled from the message thread.
+    SpectrumAnalyzer& getSpectrumAnalyzer() noexcept { return spectrumAnalyzer; }
 
     // Pop-guard for preset switching: applies a short fade-out/fade-in on the output.
     void notifyPresetLoaded() noexcept { presetPopGuardSamples.store(kPresetPopGuardTotalSamples, std::memory_order_release); }
@@ -54,6 +62,10 @@ private:
     static constexpr int kPresetPopGuardHalfSamples = 256;
     static constexpr int kPresetPopGuardTotalSamples = kPresetPopGuardHalfSamples * 2;
 
+#if defined(ROCKET_TRACE) && ROCKET_TRACE
+    TraceRecorder::Session traceSession; // first member: outlives everything that records events
+#endif
+
     juce::AudioProcessorValueTreeState apvts;
     FxChain fxChain;
     ModMatrix modMatrix;
@@ -64,8 +76,24 @@ private:
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> globalMixSmoothed;
     juce::StringArray paramIDs;
 
+    // Handles resolved once in the constructor for processBlock
+    FxParam amountParam;
+    FxParam globalMixParam;
+
     std::atomic<int> presetPopGuardSamples { 0 };
 
+    // Audio -> UI telemetry; the frame is assembled in telemetryFrame and then published
+    SeqLock<TelemetryFrame> telemetry;
+    TelemetryFrame telemetryFrame;
+    void publishTelemetry(const juce::AudioBuffer<float>& buffer);
+
+    // The audio thread only copies blocks into its FIFOs; FFTs run on the analyzer's own thread
+    SpectrumAnalyzer spectrumAnalyzer;
+
+    // Editor artwork, referenced from the first createEditor() on, so closing and reopening the
+    // editor does not decode it again. Headless hosts and tools never create it. Message thread only.
+    std::unique_ptr<juce::SharedResourcePointer<UiAssetCache>> uiAssets;
+
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TheRocketAudioProcessor)
 };
@@ -1,4 +1,5 @@
 #include "PresetManager.h"
+#include "Diagnostics/TraceRecorder.h"
 
 PresetManager::PresetManager(juce::AudioProcessorValueTreeState& state, FxChain& chain, ModMatrix& mod)
     : apvts(state), fxChain(chain), modMatrix(mod)
@@ -46,6 +47,8 @@ void PresetManager::savePreset(const juce::String& name)
 
 void PresetManager::loadPreset(const juce::String& name)
 {
+    ROCKET_TRACE_SCOPE("PresetManager::loadPreset");
+
     if (name.isEmpty())
         return;
 
@@ -231,14 +234,10 @@ void PresetManager::writePresetFileIfMissing(const juce::String& name, const juc
         xml->writeTo(file);
 }
 
-void PresetManager::addFactoryPresetsIfMissing()
+juce::StringArray PresetManager::getFactoryPresetNames()
 {
-    // Create default preset
-    auto defaultState = buildFactoryPresetState("Default");
-    writePresetFileIfMissing("Default", defaultState);
-
-    // Create a few basic presets
-    juce::StringArray factoryNames = {
+    return {
+        "Default",
         "Vocal Clean",
         "Vocal Space",
         "Bass Power",
@@ -247,8 +246,11 @@ void PresetManager::addFactoryPresetsIfMissing()
         "Lo-Fi",
         "Riser Energy"
     };
+}
 
-    for (const auto& name : factoryNames)
+void PresetManager::addFactoryPresetsIfMissing()
+{
+    for (const auto& name : getFactoryPresetNames())
     {
         auto state = buildFactoryPresetState(name);
         writePresetFileIfMissing(name, state);
@@ -13,6 +13,7 @@ public:
     void loadPreset(const juce::String& name);
     bool deletePreset(const juce::String& name);
     juce::StringArray getPresetNames() const;
+    static juce::StringArray getFactoryPresetNames();
 
     void appendState(juce::ValueTree& parent) const;
     void restoreFromState(const juce::ValueTree& parent);
@@ -0,0 +1,939 @@
+#include <JuceHeader.h>
+#include "../PluginProcessor.h"
+#include "../DSP/CompressorEngine.h"
+#include "../DSP/PartitionedConvolver.h"
+#include "../DSP/PitchShiftEngine.h"
+#include "../DSP/StereoBiquadCascade.h"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <thread>
+
+#if JUCE_INTEL && (JUCE_GCC || JUCE_CLANG)
+ #include <x86intrin.h>
+#elif JUCE_INTEL && JUCE_MSVC
+ #include <intrin.h>
+#endif
+
+// =============================================================================
+// TheRocket_Bench - per-module DSP micro-benchmarks
+//
+// Drives every FxModule subclass and the full FxChain in isolation across block
+// sizes and sample rates, reports ns/sample and cycles/sample, and writes JSON
+// that can be diffed against a stored baseline.
+// =============================================================================
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int kNumChannels = 2;
+
+    const int kAllBlockSizes[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+    const double kAllSampleRates[] = { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+
+    const int kQuickBlockSizes[] = { 64, 512, 4096 };
+    const double kQuickSampleRates[] = { 48000.0, 192000.0 };
+
+    inline juce::uint64 readCycleCounter() noexcept
+    {
+       #if JUCE_INTEL && (JUCE_GCC || JUCE_CLANG || JUCE_MSVC)
+        return (juce::uint64) __rdtsc();
+       #else
+        return 0;
+       #endif
+    }
+
+    constexpr bool hasCycleCounter() noexcept
+    {
+       #if JUCE_INTEL && (JUCE_GCC || JUCE_CLANG || JUCE_MSVC)
+        return true;
+       #else
+        return false;
+       #endif
+    }
+
+    void setParam(juce::AudioProcessorValueTreeState& apvts, const juce::String& id, float value)
+    {
+        if (auto* p = apvts.getParameter(id))
+            p->setValueNotifyingHost(p->convertTo0to1(value));
+    }
+
+    // Enables a module and puts its mix halfway so that both dry and wet paths run.
+    void enableModule(juce::AudioProcessorValueTreeState& apvts, const juce::String& id)
+    {
+        setParam(apvts, id + "_enabled", 1.0f);
+        setParam(apvts, id + "_mix", 0.5f);
+    }
+
+    // -------------------------------------------------------------------------
+    // Bench cases
+    // -------------------------------------------------------------------------
+    struct BenchTarget
+    {
+        virtual ~BenchTarget() = default;
+        virtual void prepare(double sampleRate, int blockSize) = 0;
+        virtual void process(juce::AudioBuffer<float>& buffer) = 0;
+    };
+
+    // A single module instance bound to a processor's APVTS and ModMatrix.
+    struct ModuleTarget : BenchTarget
+    {
+        ModuleTarget(TheRocketAudioProcessor& p, std::unique_ptr<FxModule> m)
+            : processor(p), module(std::move(m))
+        {
+            module->setScratchArena(&scratch);
+        }
+
+        void prepare(double sampleRate, int blockSize) override
+        {
+            scratch.prepare(kNumChannels, blockSize);
+            module->prepare({ sampleRate, (juce::uint32) blockSize, (juce::uint32) kNumChannels });
+            module->reset();
+            transport.sampleRate = sampleRate;
+            macroStep = (float) blockSize / (float) (sampleRate * kMacroSweepSeconds);
+            macroPhase = 0.0f;
+        }
+
+        // FxChain::process() feeds Amount to the ModMatrix before each sub-block; do the same once per
+        // block, swept up and down, so modulated parameters move as they do in the plugin.
+        void process(juce::AudioBuffer<float>& buffer) override
+        {
+            macroPhase = std::fmod(macroPhase + macroStep, 1.0f);
+            processor.getModMatrix().setMacroValue(1.0f - std::abs(2.0f * macroPhase - 1.0f));
+            module->process(buffer, processor.getModMatrix(), transport);
+        }
+
+        static constexpr double kMacroSweepSeconds = 2.0;
+
+        TheRocketAudioProcessor& processor;
+        ScratchArena scratch;
+        std::unique_ptr<FxModule> module;
+        FxTransportInfo transport;
+        float macroPhase = 0.0f;
+        float macroStep = 0.0f;
+    };
+
+    // The whole FxChain, driven directly rather than through processBlock.
+    struct ChainTarget : BenchTarget
+    {
+        explicit ChainTarget(TheRocketAudioProcessor& p) : processor(p) {}
+
+        void prepare(double sampleRate, int blockSize) override
+        {
+            processor.getFxChain().prepare({ sampleRate, (juce::uint32) blockSize, (juce::uint32) kNumChannels });
+            processor.getFxChain().reset();
+            processor.getModMatrix().prepare(sampleRate, blockSize);
+            amount.reset(sampleRate, 0.05);
+            amount.setCurrentAndTargetValue(1.0f);
+            transport.sampleRate = sampleRate;
+        }
+
+        void process(juce::AudioBuffer<float>& buffer) override
+        {
+            processor.getFxChain().process(buffer, amount, processor.getModMatrix(), transport);
+        }
+
+        TheRocketAudioProcessor& processor;
+        juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> amount;
+        FxTransportInfo transport;
+    };
+
+    // PitchShiftEngine on its own, +7 semitones, fully wet.
+    struct PitchEngineTarget : BenchTarget
+    {
+        explicit PitchEngineTarget(PitchShiftEngine::Mode m) : mode(m) {}
+
+        void prepare(double sampleRate, int) override
+        {
+            engine.prepare(sampleRate, kNumChannels);
+            engine.setMode(mode);
+            engine.setSemitones(7.0f);
+            engine.setMix(1.0f);
+        }
+
+        void process(juce::AudioBuffer<float>& buffer) override { engine.process(buffer); }
+
+        PitchShiftEngine::Mode mode;
+        PitchShiftEngine engine;
+    };
+
+    // The dual-tap shifter DemoFxChain used before PitchShiftEngine, kept as the reference
+    // the engine has to beat: 120 ms ring, fmod/floor/sin per sample.
+    struct LegacyPitchTarget : BenchTarget
+    {
+        void prepare(double sampleRate, int) override
+        {
+            ringSize = juce::jlimit(2048, 131072, (int) std::round(sampleRate * 0.12));
+            ring.setSize(kNumChannels, ringSize);
+            ring.clear();
+            writePos = 0;
+            readPosA = 0.0f;
+            readPosB = (float) ringSize * 0.5f;
+            speed = std::pow(2.0f, 7.0f / 12.0f);
+        }
+
+        void process(juce::AudioBuffer<float>& buffer) override
+        {
+            const auto readSample = [&](int ch, float pos)
+            {
+                const int i0 = (int) std::floor(pos);
+                const int i1 = (i0 + 1) % ringSize;
+                const float frac = pos - (float) i0;
+                const auto* r = ring.getReadPointer(ch);
+                return r[i0] + frac * (r[i1] - r[i0]);
+            };
+
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+            {
+                const float aDist = std::fmod((float) writePos - readPosA + (float) ringSize, (float) ringSize);
+                const float bDist = std::fmod((float) writePos - readPosB + (float) ringSize, (float) ringSize);
+                const float wA = std::sin(juce::jlimit(0.0f, 1.0f, aDist / ((float) ringSize * 0.5f)) * juce::MathConstants<float>::pi);
+                const float wB = std::sin(juce::jlimit(0.0f, 1.0f, bDist / ((float) ringSize * 0.5f)) * juce::MathConstants<float>::pi);
+                const float norm = (wA + wB) > 0.0001f ? (1.0f / (wA + wB)) : 1.0f;
+
+                for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+                {
+                    ring.setSample(ch, writePos, buffer.getSample(ch, i));
+                    buffer.setSample(ch, i, (wA * readSample(ch, readPosA) + wB * readSample(ch, readPosB)) * norm);
+                }
+
+                writePos = (writePos + 1) % ringSize;
+                readPosA += speed;
+                readPosB += speed;
+                if (readPosA >= (float) ringSize) readPosA -= (float) ringSize;
+                if (readPosB >= (float) ringSize) readPosB -= (float) ringSize;
+                if (std::abs((float) writePos - readPosA) < 32.0f)
+                    readPosA = std::fmod(readPosA + (float) ringSize * 0.5f, (float) ringSize);
+                if (std::abs((float) writePos - readPosB) < 32.0f)
+                    readPosB = std::fmod(readPosB + (float) ringSize * 0.5f, (float) ringSize);
+            }
+        }
+
+        juce::AudioBuffer<float> ring;
+        int ringSize = 0;
+        int writePos = 0;
+        float readPosA = 0.0f;
+        float readPosB = 0.0f;
+        float speed = 1.0f;
+    };
+
+    // CompressorEngine with settings that keep it compressing the -12 dBFS test noise.
+    struct CompressorEngineTarget : BenchTarget
+    {
+        explicit CompressorEngineTarget(float lookaheadMsIn) : lookaheadMs(lookaheadMsIn) {}
+
+        void prepare(double sampleRate, int blockSize) override
+        {
+            engine.prepare(sampleRate, blockSize, kNumChannels);
+            engine.setParameters(-24.0f, 4.0f, 5.0f, 100.0f);
+            engine.setInOutGain(3.0f, 2.0f);
+            engine.setLookahead(lookaheadMs);
+        }
+
+        void process(juce::AudioBuffer<float>& buffer) override { engine.process(buffer); }
+
+        float lookaheadMs;
+        CompressorEngine engine;
+    };
+
+    // juce::dsp::Compressor with the same settings and the gain passes DemoFxChain::Comp used around it.
+    struct JuceCompressorTarget : BenchTarget
+    {
+        void prepare(double sampleRate, int blockSize) override
+        {
+            comp.prepare({ sampleRate, (juce::uint32) blockSize, (juce::uint32) kNumChannels });
+            comp.setThreshold(-24.0f);
+            comp.setRatio(4.0f);
+            comp.setAttack(5.0f);
+            comp.setRelease(100.0f);
+            comp.reset();
+        }
+
+        void process(juce::AudioBuffer<float>& buffer) override
+        {
+            buffer.applyGain(juce::Decibels::decibelsToGain(3.0f));
+            auto block = juce::dsp::AudioBlock<float>(buffer);
+            comp.process(juce::dsp::ProcessContextReplacing<float>(block));
+            buffer.applyGain(juce::Decibels::decibelsToGain(2.0f));
+        }
+
+        juce::dsp::Compressor<float> comp;
+    };
+
+    // juce::Reverb (Freeverb) with the settings ReverbModule used to give it at the default parameters.
+    struct FreeverbTarget : BenchTarget
+    {
+        void prepare(double sampleRate, int) override
+        {
+            reverb.setSampleRate(sampleRate);
+
+            juce::Reverb::Parameters params;
+            params.roomSize = 0.5f;
+            params.damping = 0.5f;
+            params.wetLevel = 0.3f;
+            params.dryLevel = 0.7f;
+            params.width = 1.0f;
+            reverb.setParameters(params);
+            reverb.reset();
+        }
+
+        void process(juce::AudioBuffer<float>& buffer) override
+        {
+            reverb.processStereo(buffer.getWritePointer(0), buffer.getWritePointer(1), buffer.getNumSamples());
+        }
+
+        juce::Reverb reverb;
+    };
+
+    constexpr float kConvolutionIrSeconds = 4.0f;
+
+    // PartitionedConvolver with a kConvolutionIrSeconds IR. The bench runs faster than real time,
+    // so most tail jobs are still pending at their deadline and run inline: this is the total cost.
+    struct PartitionedConvolverTarget : BenchTarget
+    {
+        void prepare(double sampleRate, int) override { convolver.prepare(sampleRate, kNumChannels, kConvolutionIrSeconds); }
+        void process(juce::AudioBuffer<float>& buffer) override { convolver.process(buffer); }
+
+        PartitionedConvolver convolver;
+    };
+
+    // juce::dsp::Convolution with a decaying-noise IR of the same length.
+    struct JuceConvolutionTarget : BenchTarget
+    {
+        void prepare(double sampleRate, int blockSize) override
+        {
+            conv.prepare({ sampleRate, (juce::uint32) blockSize, (juce::uint32) kNumChannels });
+
+            const int length = juce::roundToInt(kConvolutionIrSeconds * sampleRate);
+            juce::AudioBuffer<float> ir(1, length);
+            juce::Random rng(12345);
+            const float decayCoeff = std::pow(0.001f, 1.0f / (float) length);
+            float env = 1.0f;
+            for (int i = 0; i < length; ++i)
+            {
+                ir.setSample(0, i, (rng.nextFloat() * 2.0f - 1.0f) * env);
+                env *= decayCoeff;
+            }
+
+            conv.loadImpulseResponse(std::move(ir), sampleRate, juce::dsp::Convolution::Stereo::no,
+                                     juce::dsp::Convolution::Trim::no, juce::dsp::Convolution::Normalise::yes);
+
+            // The IR is loaded in the background and swapped in by process(); wait for it
+            juce::AudioBuffer<float> silence(kNumChannels, blockSize);
+            for (int attempt = 0; attempt < 500 && conv.getCurrentIRSize() == 0; ++attempt)
+            {
+                silence.clear();
+                auto block = juce::dsp::AudioBlock<float>(silence);
+                conv.process(juce::dsp::ProcessContextReplacing<float>(block));
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            conv.reset();
+        }
+
+        void process(juce::AudioBuffer<float>& buffer) override
+        {
+            auto block = juce::dsp::AudioBlock<float>(buffer);
+            conv.process(juce::dsp::ProcessContextReplacing<float>(block));
+        }
+
+        juce::dsp::Convolution conv;
+    };
+
+    // Six EQ sections as DemoFxChain::Eq4 designs them: low cut, high cut and four peaking bands.
+    constexpr int kEqSections = 6;
+
+    std::array<StereoBiquadCascade<kEqSections>::ArrayCoefficients, kEqSections> makeEqSections(double sampleRate)
+    {
+        using Design = juce::dsp::IIR::ArrayCoefficients<float>;
+        return { Design::makeHighPass(sampleRate, 30.0f),
+                 Design::makeLowPass(sampleRate, 18000.0f),
+                 Design::makePeakFilter(sampleRate, 120.0f, 0.8f, juce::Decibels::decibelsToGain(3.0f)),
+                 Design::makePeakFilter(sampleRate, 800.0f, 1.2f, juce::Decibels::decibelsToGain(-4.0f)),
+                 Design::makePeakFilter(sampleRate, 3000.0f, 1.0f, juce::Decibels::decibelsToGain(2.5f)),
+                 Design::makePeakFilter(sampleRate, 9000.0f, 0.7f, juce::Decibels::decibelsToGain(-2.0f)) };
+    }
+
+    // StereoBiquadCascade: both channels of all six sections in one SIMD pass.
+    struct BiquadCascadeTarget : BenchTarget
+    {
+        void prepare(double sampleRate, int) override
+        {
+            const auto sections = makeEqSections(sampleRate);
+            for (int i = 0; i < kEqSections; ++i)
+                cascade.setSection(i, sections[(size_t) i]);
+            cascade.reset();
+        }
+
+        void process(juce::AudioBuffer<float>& buffer) override
+        {
+            cascade.process(buffer.getWritePointer(0), buffer.getWritePointer(1), buffer.getNumSamples());
+        }
+
+        StereoBiquadCascade<kEqSections> cascade;
+    };
+
+    // The same sections as twelve juce::dsp::IIR::Filters, one per section and channel.
+    struct JuceBiquadTarget : BenchTarget
+    {
+        void prepare(double sampleRate, int blockSize) override
+        {
+            const auto sections = makeEqSections(sampleRate);
+            for (int i = 0; i < kEqSections; ++i)
+            {
+                auto coefficients = juce::dsp::IIR::Coefficients<float>::Ptr(new juce::dsp::IIR::Coefficients<float>(sections[(size_t) i]));
+                for (int ch = 0; ch < kNumChannels; ++ch)
+                {
+                    auto& filter = filters[(size_t) (ch * kEqSections + i)];
+                    filter.coefficients = coefficients;
+                    filter.prepare({ sampleRate, (juce::uint32) blockSize, 1 });
+                    filter.reset();
+                }
+            }
+        }
+
+        void process(juce::AudioBuffer<float>& buffer) override
+        {
+            auto block = juce::dsp::AudioBlock<float>(buffer);
+            for (int ch = 0; ch < kNumChannels; ++ch)
+            {
+                auto channel = block.getSingleChannelBlock((size_t) ch);
+                for (int i = 0; i < kEqSections; ++i)
+                    filters[(size_t) (ch * kEqSections + i)].process(juce::dsp::ProcessContextReplacing<float>(channel));
+            }
+        }
+
+        std::array<juce::dsp::IIR::Filter<float>, (size_t) (kNumChannels * kEqSections)> filters;
+    };
+
+    struct BenchCase
+    {
+        juce::String name;
+        std::function<std::unique_ptr<BenchTarget>(TheRocketAudioProcessor&)> create;
+    };
+
+    template <typename ModuleType, typename... Args>
+    std::unique_ptr<BenchTarget> makeModuleTarget(TheRocketAudioProcessor& p, Args&&... args)
+    {
+        auto module = std::make_unique<ModuleType>(p.getAPVTS(), std::forward<Args>(args)...);
+        enableModule(p.getAPVTS(), module->getId());
+        return std::make_unique<ModuleTarget>(p, std::move(module));
+    }
+
+    std::vector<BenchCase> buildCases()
+    {
+        std::vector<BenchCase> cases;
+
+        cases.push_back({ "reverb", [] (auto& p) { return makeModuleTarget<ReverbModule>(p); } });
+        cases.push_back({ "reverb_freeverb", [] (auto&) -> std::unique_ptr<BenchTarget> { return std::make_unique<FreeverbTarget>(); } });
+        cases.push_back({ "delay", [] (auto& p) { return makeModuleTarget<DelayModule>(p, 1); } });
+
+        const char* slopeNames[] = { "6dB", "12dB", "24dB", "96dB" };
+        for (int slope = 0; slope < 4; ++slope)
+        {
+            cases.push_back({ "filter_lp_" + juce::String(slopeNames[slope]), [slope] (auto& p)
+            {
+                setParam(p.getAPVTS(), "filter_lp_slope", (float) slope);
+                setParam(p.getAPVTS(), "filter_lp_cutoff", 1000.0f);
+                return makeModuleTarget<FilterModule>(p, FilterModule::Type::LowPass, juce::String("filter_lp"));
+            } });
+            cases.push_back({ "filter_hp_" + juce::String(slopeNames[slope]), [slope] (auto& p)
+            {
+                setParam(p.getAPVTS(), "filter_hp_slope", (float) slope);
+                setParam(p.getAPVTS(), "filter_hp_cutoff", 1000.0f);
+                return makeModuleTarget<FilterModule>(p, FilterModule::Type::HighPass, juce::String("filter_hp"));
+            } });
+        }
+
+        cases.push_back({ "flanger", [] (auto& p) { return makeModuleTarget<FlangerModule>(p); } });
+        cases.push_back({ "phaser", [] (auto& p) { return makeModuleTarget<PhaserModule>(p); } });
+        cases.push_back({ "bitcrush", [] (auto& p)
+        {
+            setParam(p.getAPVTS(), "bitcrush_bits", 8.0f);
+            setParam(p.getAPVTS(), "bitcrush_downsample", 4.0f);
+            return makeModuleTarget<BitcrusherModule>(p);
+        } });
+        cases.push_back({ "distortion", [] (auto& p) { return makeModuleTarget<DistortionModule>(p); } });
+        cases.push_back({ "eq", [] (auto& p)
+        {
+            setParam(p.getAPVTS(), "eq_mid_gain", 3.0f);
+            return makeModuleTarget<EQModule>(p, juce::String("eq"));
+        } });
+        cases.push_back({ "tremolo", [] (auto& p) { return makeModuleTarget<TremoloModule>(p); } });
+        cases.push_back({ "ringmod", [] (auto& p) { return makeModuleTarget<RingModModule>(p); } });
+        cases.push_back({ "noisegen", [] (auto& p)
+        {
+            setParam(p.getAPVTS(), "noisegen_gain", 0.5f);
+            return makeModuleTarget<NoiseGenModule>(p);
+        } });
+        cases.push_back({ "tonegen", [] (auto& p)
+        {
+            setParam(p.getAPVTS(), "tonegen_gain", 0.5f);
+            return makeModuleTarget<ToneGenModule>(p);
+        } });
+
+        // Compressor engine against juce::dsp::Compressor (1% of a core is realtime factor 100)
+        cases.push_back({ "comp_juce", [] (auto&) -> std::unique_ptr<BenchTarget> { return std::make_unique<JuceCompressorTarget>(); } });
+        cases.push_back({ "comp_engine", [] (auto&) -> std::unique_ptr<BenchTarget>
+        {
+            return std::make_unique<CompressorEngineTarget>(0.0f);
+        } });
+        cases.push_back({ "comp_engine_lookahead", [] (auto&) -> std::unique_ptr<BenchTarget>
+        {
+            return std::make_unique<CompressorEngineTarget>(5.0f);
+        } });
+
+        // Pitch engine modes against the legacy shifter (both stereo, so halve for per-channel cost)
+        cases.push_back({ "pitch_legacy", [] (auto&) -> std::unique_ptr<BenchTarget> { return std::make_unique<LegacyPitchTarget>(); } });
+        cases.push_back({ "pitch_low", [] (auto&) -> std::unique_ptr<BenchTarget>
+        {
+            return std::make_unique<PitchEngineTarget>(PitchShiftEngine::Mode::lowLatency);
+        } });
+        cases.push_back({ "pitch_balanced", [] (auto&) -> std::unique_ptr<BenchTarget>
+        {
+            return std::make_unique<PitchEngineTarget>(PitchShiftEngine::Mode::balanced);
+        } });
+        cases.push_back({ "pitch_hq", [] (auto&) -> std::unique_ptr<BenchTarget>
+        {
+            return std::make_unique<PitchEngineTarget>(PitchShiftEngine::Mode::highQuality);
+        } });
+
+        // Convolution reverb with a multi-second IR against juce::dsp::Convolution
+        cases.push_back({ "conv_juce", [] (auto&) -> std::unique_ptr<BenchTarget> { return std::make_unique<JuceConvolutionTarget>(); } });
+        cases.push_back({ "conv_partitioned", [] (auto&) -> std::unique_ptr<BenchTarget> { return std::make_unique<PartitionedConvolverTarget>(); } });
+
+        // Six-section EQ cascade against one juce::dsp::IIR::Filter per section and channel
+        cases.push_back({ "biquad_juce", [] (auto&) -> std::unique_ptr<BenchTarget> { return std::make_unique<JuceBiquadTarget>(); } });
+        cases.push_back({ "biquad_cascade", [] (auto&) -> std::unique_ptr<BenchTarget> { return std::make_unique<BiquadCascadeTarget>(); } });
+
+        // Full chain with the default parameter state
+        cases.push_back({ "chain_default", [] (auto& p) -> std::unique_ptr<BenchTarget>
+        {
+            return std::make_unique<ChainTarget>(p);
+        } });
+
+        // Full chain with every module switched on (worst case)
+        cases.push_back({ "chain_all", [] (auto& p) -> std::unique_ptr<BenchTarget>
+        {
+            for (const auto& id : p.getFxChain().getModuleOrder())
+                enableModule(p.getAPVTS(), id);
+            setParam(p.getAPVTS(), "noisegen_enabled", 1.0f);
+            setParam(p.getAPVTS(), "noisegen_gain", 0.2f);
+            setParam(p.getAPVTS(), "tonegen_enabled", 1.0f);
+            setParam(p.getAPVTS(), "tonegen_gain", 0.2f);
+            return std::make_unique<ChainTarget>(p);
+        } });
+
+        return cases;
+    }
+
+    // -------------------------------------------------------------------------
+    // Measurement
+    // -------------------------------------------------------------------------
+    struct Measurement
+    {
+        juce::String caseName;
+        double sampleRate = 0.0;
+        int blockSize = 0;
+        double nsPerSample = 0.0;
+        double cyclesPerSample = 0.0;
+        double realtimeFactor = 0.0;
+
+        juce::String key() const { return caseName + "@" + juce::String((int) sampleRate) + "/" + juce::String(blockSize); }
+    };
+
+    Measurement measure(BenchTarget& target, const juce::String& caseName, double sampleRate, int blockSize,
+                        double audioSeconds, const juce::AudioBuffer<float>& source)
+    {
+        target.prepare(sampleRate, blockSize);
+
+        juce::AudioBuffer<float> buffer(kNumChannels, blockSize);
+        const int sourceLength = source.getNumSamples();
+        int sourcePos = 0;
+
+        auto fillFromSource = [&]
+        {
+            if (sourcePos + blockSize > sourceLength)
+                sourcePos = 0;
+            for (int ch = 0; ch < kNumChannels; ++ch)
+                buffer.copyFrom(ch, 0, source, ch, sourcePos, blockSize);
+            sourcePos += blockSize;
+        };
+
+        // Warm up caches, smoothers and lazily-initialised state
+        const int warmupBlocks = juce::jmax(8, (int) (0.05 * sampleRate) / blockSize);
+        for (int i = 0; i < warmupBlocks; ++i)
+        {
+            fillFromSource();
+            target.process(buffer);
+        }
+
+        const int numBlocks = juce::jmax(16, (int) (audioSeconds * sampleRate) / blockSize);
+
+        double totalNs = 0.0;
+        juce::uint64 totalCycles = 0;
+
+        for (int i = 0; i < numBlocks; ++i)
+        {
+            fillFromSource();
+
+            const auto t0 = Clock::now();
+            const auto c0 = readCycleCounter();
+            target.process(buffer);
+            const auto c1 = readCycleCounter();
+            const auto t1 = Clock::now();
+
+            totalNs += (double) std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+            totalCycles += c1 - c0;
+        }
+
+        const double totalSamples = (double) numBlocks * (double) blockSize;
+
+        Measurement m;
+        m.caseName = caseName;
+        m.sampleRate = sampleRate;
+        m.blockSize = blockSize;
+        m.nsPerSample = totalNs / totalSamples;
+
+        if (hasCycleCounter())
+            m.cyclesPerSample = (double) totalCycles / totalSamples;
+        else
+            m.cyclesPerSample = m.nsPerSample * (double) juce::SystemStats::getCpuSpeedInMegahertz() * 1.0e-3;
+
+        m.realtimeFactor = 1.0e9 / (m.nsPerSample * sampleRate);
+        return m;
+    }
+
+    // -------------------------------------------------------------------------
+    // JSON output / baseline comparison
+    // -------------------------------------------------------------------------
+    juce::var toJson(const std::vector<Measurement>& results)
+    {
+        auto* root = new juce::DynamicObject();
+        root->setProperty("version", 1);
+        root->setProperty("cpu", juce::SystemStats::getCpuModel());
+        root->setProperty("cpuMHz", juce::SystemStats::getCpuSpeedInMegahertz());
+        root->setProperty("os", juce::SystemStats::getOperatingSystemName());
+        root->setProperty("cyclesSource", hasCycleCounter() ? "tsc" : "estimated");
+        root->setProperty("date", juce::Time::getCurrentTime().toISO8601(true));
+
+        juce::Array<juce::var> entries;
+        for (const auto& m : results)
+        {
+            auto* e = new juce::DynamicObject();
+            e->setProperty("key", m.key());
+            e->setProperty("case", m.caseName);
+            e->setProperty("sampleRate", m.sampleRate);
+            e->setProperty("blockSize", m.blockSize);
+            e->setProperty("nsPerSample", m.nsPerSample);
+            e->setProperty("cyclesPerSample", m.cyclesPerSample);
+            e->setProperty("realtimeFactor", m.realtimeFactor);
+            entries.add(juce::var(e));
+        }
+
+        root->setProperty("results", entries);
+        return juce::var(root);
+    }
+
+    // Returns the number of results that regressed by more than thresholdPercent.
+    int compareWithBaseline(const std::vector<Measurement>& results, const juce::File& baselineFile, double thresholdPercent)
+    {
+        const auto baseline = juce::JSON::parse(baselineFile);
+        auto* baselineResults = baseline["results"].getArray();
+        if (baselineResults == nullptr)
+            juce::ConsoleApplication::fail("Baseline " + baselineFile.getFullPathName() + " has no results");
+
+        std::map<juce::String, double> baselineNs;
+        for (const auto& e : *baselineResults)
+            baselineNs[e["key"].toString()] = (double) e["nsPerSample"];
+
+        std::cout << std::endl << "Baseline comparison (threshold " << thresholdPercent << "%)" << std::endl;
+
+        int regressions = 0;
+        for (const auto& m : results)
+        {
+            const auto it = baselineNs.find(m.key());
+            if (it == baselineNs.end() || it->second <= 0.0)
+                continue;
+
+            const double deltaPercent = 100.0 * (m.nsPerSample - it->second) / it->second;
+            const bool regressed = deltaPercent > thresholdPercent;
+            if (regressed)
+                ++regressions;
+
+            std::cout << (regressed ? "  REGRESSION " : "             ")
+                      << m.key().paddedRight(' ', 32)
+                      << juce::String(it->second, 2).paddedLeft(' ', 10) << " -> "
+                      << juce::String(m.nsPerSample, 2).paddedLeft(' ', 10) << " ns/sample  "
+                      << (deltaPercent >= 0.0 ? "+" : "") << juce::String(deltaPercent, 1) << "%" << std::endl;
+        }
+
+        return regressions;
+    }
+
+    void runBench(const juce::ArgumentList& args)
+    {
+        const bool quick = args.containsOption("--quick");
+        const double audioSeconds = args.containsOption("--seconds")
+                                      ? juce::jmax(0.01, args.getValueForOption("--seconds").getDoubleValue())
+                                      : 0.5;
+        const auto filter = args.getValueForOption("--filter");
+        const int controlBlockSize = args.containsOption("--control-block")
+                                       ? args.getValueForOption("--control-block").getIntValue()
+                                       : FxChain::kDefaultControlBlockSize;
+
+        std::vector<int> blockSizes;
+        std::vector<double> sampleRates;
+        if (quick)
+        {
+            blockSizes.assign(std::begin(kQuickBlockSizes), std::end(kQuickBlockSizes));
+            sampleRates.assign(std::begin(kQuickSampleRates), std::end(kQuickSampleRates));
+        }
+        else
+        {
+            blockSizes.assign(std::begin(kAllBlockSizes), std::end(kAllBlockSizes));
+            sampleRates.assign(std::begin(kAllSampleRates), std::end(kAllSampleRates));
+        }
+
+        // 64k samples of stereo noise at -12 dBFS as the test signal
+        juce::AudioBuffer<float> source(kNumChannels, 1 << 16);
+        juce::Random rng(0x5eed);
+        for (int ch = 0; ch < kNumChannels; ++ch)
+            for (int i = 0; i < source.getNumSamples(); ++i)
+                source.setSample(ch, i, (rng.nextFloat() * 2.0f - 1.0f) * 0.25f);
+
+        std::vector<Measurement> results;
+
+        std::cout << juce::String("case").paddedRight(' ', 20)
+                  << juce::String("rate").paddedLeft(' ', 8) << juce::String("block").paddedLeft(' ', 7)
+                  << juce::String("ns/smp").paddedLeft(' ', 10) << juce::String("cyc/smp").paddedLeft(' ', 10)
+                  << juce::String("x rt").paddedLeft(' ', 10) << std::endl;
+
+        for (const auto& benchCase : buildCases())
+        {
+            if (filter.isNotEmpty() && !benchCase.name.contains(filter))
+                continue;
+
+            // Fresh processor per case so one case's parameter tweaks don't leak into the next
+            TheRocketAudioProcessor processor;
+            processor.getFxChain().setControlBlockSize(controlBlockSize);
+            auto target = benchCase.create(processor);
+
+            for (const auto sampleRate : sampleRates)
+            {
+                for (const auto blockSize : blockSizes)
+                {
+                    const auto m = measure(*target, benchCase.name, sampleRate, blockSize, audioSeconds, source);
+                    results.push_back(m);
+
+                    std::cout << m.caseName.paddedRight(' ', 20)
+                              << juce::String((int) m.sampleRate).paddedLeft(' ', 8)
+                              << juce::String(m.blockSize).paddedLeft(' ', 7)
+                              << juce::String(m.nsPerSample, 2).paddedLeft(' ', 10)
+                              << juce::String(m.cyclesPerSample, 1).paddedLeft(' ', 10)
+                              << juce::String(m.realtimeFactor, 0).paddedLeft(' ', 10) << std::endl;
+                }
+            }
+        }
+
+        if (args.containsOption("--out"))
+        {
+            const auto outFile = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--out"));
+            if (!outFile.replaceWithText(juce::JSON::toString(toJson(results))))
+                juce::ConsoleApplication::fail("Cannot write " + outFile.getFullPathName());
+            std::cout << std::endl << "Wrote " << outFile.getFullPathName() << std::endl;
+        }
+
+        if (args.containsOption("--baseline"))
+        {
+            const auto baselineFile = args.getExistingFileForOption("--baseline");
+            const double threshold = args.containsOption("--threshold")
+                                       ? args.getValueForOption("--threshold").getDoubleValue()
+                                       : 10.0;
+
+            const int regressions = compareWithBaseline(results, baselineFile, threshold);
+            if (regressions > 0)
+                juce::ConsoleApplication::fail(juce::String(regressions) + " result(s) regressed beyond "
+                                               + juce::String(threshold) + "%");
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // ModMatrix / chain-order stress: edits hammered from this thread while a
+    // second thread runs processBlock as fast as it can.
+    // -------------------------------------------------------------------------
+    void runModMatrixStress(const juce::ArgumentList& args)
+    {
+        const double seconds = args.containsOption("--seconds")
+                                 ? juce::jmax(0.1, args.getValueForOption("--seconds").getDoubleValue())
+                                 : 10.0;
+        constexpr double sampleRate = 48000.0;
+        constexpr int blockSize = 64;
+
+        TheRocketAudioProcessor processor;
+        processor.setPlayConfigDetails(kNumChannels, kNumChannels, sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        // Turn everything on so modulated targets are actually read
+        for (const auto& id : processor.getFxChain().getModuleOrder())
+            enableModule(processor.getAPVTS(), id);
+
+        std::atomic<bool> running { true };
+        std::atomic<bool> nonFinite { false };
+        std::atomic<juce::int64> inconsistentTables { 0 };
+        std::atomic<juce::int64> generationRegressions { 0 };
+        std::atomic<juce::int64> blocksProcessed { 0 };
+        std::atomic<double> worstBlockNs { 0.0 };
+
+        std::thread audioThread ([&]
+        {
+            juce::AudioBuffer<float> buffer(kNumChannels, blockSize);
+            juce::MidiBuffer midi;
+            juce::Random rng(1);
+            auto& amount = *processor.getAPVTS().getParameter("amount");
+            double worst = 0.0;
+            std::uint32_t lastGeneration = 0;
+
+            while (running.load(std::memory_order_relaxed))
+            {
+                for (int ch = 0; ch < kNumChannels; ++ch)
+                    for (int i = 0; i < blockSize; ++i)
+                        buffer.setSample(ch, i, (rng.nextFloat() * 2.0f - 1.0f) * 0.25f);
+
+                amount.setValueNotifyingHost(rng.nextFloat());
+
+                const auto t0 = Clock::now();
+                processor.processBlock(buffer, midi);
+                const auto t1 = Clock::now();
+                worst = juce::jmax(worst, (double) std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+
+                for (int ch = 0; ch < kNumChannels; ++ch)
+                    for (int i = 0; i < blockSize; ++i)
+                        if (!std::isfinite(buffer.getSample(ch, i)))
+                            nonFinite.store(true);
+
+                // The table processBlock used must be exactly one that commit() built, and never older
+                // than one seen before
+                const auto check = processor.getModMatrix().checkActiveTable();
+                if (!check.consistent)
+                    inconsistentTables.fetch_add(1, std::memory_order_relaxed);
+                if (check.generation < lastGeneration)
+                    generationRegressions.fetch_add(1, std::memory_order_relaxed);
+                lastGeneration = juce::jmax(lastGeneration, check.generation);
+
+                blocksProcessed.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            worstBlockNs.store(worst);
+        });
+
+        auto& modMatrix = processor.getModMatrix();
+        const auto& paramIDs = processor.getParameterIDs();
+        juce::Random rng(2);
+        juce::int64 edits = 0;
+
+        auto randomAssignment = [&]
+        {
+            ModMatrix::Assignment a;
+            a.paramID = paramIDs[rng.nextInt(paramIDs.size())];
+            a.amount = rng.nextFloat() * 2.0f - 1.0f;
+            a.useRange = rng.nextBool();
+            if (auto* p = processor.getAPVTS().getParameter(a.paramID))
+            {
+                const auto range = p->getNormalisableRange();
+                a.min = range.convertFrom0to1(rng.nextFloat());
+                a.max = range.convertFrom0to1(rng.nextFloat());
+            }
+            return a;
+        };
+
+        const auto endTime = Clock::now() + std::chrono::microseconds((juce::int64) (seconds * 1.0e6));
+        while (Clock::now() < endTime)
+        {
+            switch (rng.nextInt(6))
+            {
+                case 0:
+                case 1:
+                    modMatrix.addAssignment(randomAssignment());
+                    break;
+                case 2:
+                    if (modMatrix.getAssignments().size() > 0)
+                        modMatrix.removeAssignment(rng.nextInt(modMatrix.getAssignments().size()));
+                    break;
+                case 3:
+                {
+                    const ModMatrix::ScopedBatch batch(modMatrix);
+                    modMatrix.clear();
+                    for (int i = rng.nextInt(16); --i >= 0;)
+                        modMatrix.addAssignment(randomAssignment());
+                    break;
+                }
+                case 4:
+                {
+                    juce::ValueTree state("STATE");
+                    modMatrix.appendState(state);
+                    modMatrix.restoreFromState(state);
+                    break;
+                }
+                default:
+                {
+                    const int numModules = processor.getFxChain().getModuleOrder().size();
+                    processor.getFxChain().moveModule(rng.nextInt(numModules), rng.nextInt(numModules));
+                    break;
+                }
+            }
+
+            ++edits;
+        }
+
+        running.store(false);
+        audioThread.join();
+
+        std::cout << "Edits:             " << edits << std::endl
+                  << "Blocks processed:  " << blocksProcessed.load() << std::endl
+                  << "Bad tables seen:   " << inconsistentTables.load() + generationRegressions.load() << std::endl
+                  << "Worst block:       " << juce::String(worstBlockNs.load() * 1.0e-3, 1)
+                  << " us (budget " << juce::String(1.0e6 * blockSize / sampleRate, 1) << " us)" << std::endl;
+
+        if (blocksProcessed.load() == 0)
+            juce::ConsoleApplication::fail("Audio thread made no progress");
+        if (nonFinite.load())
+            juce::ConsoleApplication::fail("Non-finite output detected");
+        if (inconsistentTables.load() > 0)
+            juce::ConsoleApplication::fail(juce::String(inconsistentTables.load()) + " block(s) saw a torn or mixed-up assignment table");
+        if (generationRegressions.load() > 0)
+            juce::ConsoleApplication::fail(juce::String(generationRegressions.load()) + " block(s) saw an older assignment table than a previous block");
+
+        std::cout << "PASSED" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand("--help|-h", "The Rocket DSP micro-benchmarks", false);
+    app.addDefaultCommand({ "",
+                            "[--quick] [--seconds=<audio seconds per config>] [--filter=<case substring>] [--control-block=<samples>] "
+                            "[--out=<results.json>] [--baseline=<baseline.json> [--threshold=<percent>]]",
+                            "Benchmarks every FX module and the full chain",
+                            "Runs each module (filters at every slope) and FxChain::process over block sizes 16-4096 "
+                            "and sample rates 44.1k-192k, printing ns/sample and cycles/sample. --out writes JSON; "
+                            "--baseline compares against a previous JSON run and fails if any result is slower by "
+                            "more than --threshold percent (default 10).",
+                            runBench });
+    app.addCommand({ "--stress-modmatrix",
+                     "--stress-modmatrix [--seconds=<duration>]",
+                     "Hammers ModMatrix and chain-order edits while audio is processed",
+                     "Runs processBlock continuously on one thread while this thread adds, removes, batches "
+                     "and restores ModMatrix assignments and reorders modules. Fails on non-finite output, or if "
+                     "any block sees an assignment table whose checksum or cross-references do not match, or one "
+                     "older than a table an earlier block saw.",
+                     runModMatrixStress });
+
+    return app.findAndRunCommand(argc, argv);
+}
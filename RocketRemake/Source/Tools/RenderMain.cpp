@@ -0,0 +1,424 @@
+#include <JuceHeader.h>
+#include "../PluginProcessor.h"
+
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+
+// =============================================================================
+// TheRocket_Render - headless batch renderer
+//
+// Streams WAV/AIFF files through TheRocketAudioProcessor without an editor and
+// spreads a directory of files across a thread pool (one processor per worker).
+// =============================================================================
+namespace
+{
+    constexpr int kDefaultBlockSize = 512;
+
+    std::mutex consoleLock;
+
+    void printLine(const juce::String& text)
+    {
+        const std::lock_guard<std::mutex> lock(consoleLock);
+        std::cout << text << std::endl;
+    }
+
+    // Amount automation: a constant value or a piecewise-linear curve of (seconds, value) points.
+    class AmountCurve
+    {
+    public:
+        static AmountCurve constant(float value)
+        {
+            AmountCurve c;
+            c.points.push_back({ 0.0, juce::jlimit(0.0f, 1.0f, value) });
+            return c;
+        }
+
+        // Accepts either a file with one "seconds value" pair per line, or an inline
+        // list such as "0:0,2.5:1,4:0".
+        static bool parse(const juce::String& spec, AmountCurve& result)
+        {
+            juce::StringArray pairs;
+            const juce::File file = juce::File::getCurrentWorkingDirectory().getChildFile(spec);
+
+            if (file.existsAsFile())
+                pairs.addLines(file.loadFileAsString());
+            else
+                pairs.addTokens(spec, ",", {});
+
+            AmountCurve c;
+            for (auto pair : pairs)
+            {
+                pair = pair.trim();
+                if (pair.isEmpty() || pair.startsWithChar('#'))
+                    continue;
+
+                const auto tokens = juce::StringArray::fromTokens(pair.replaceCharacter(':', ' '), " \t", {});
+                if (tokens.size() != 2)
+                    return false;
+
+                c.points.push_back({ tokens[0].getDoubleValue(), juce::jlimit(0.0f, 1.0f, tokens[1].getFloatValue()) });
+            }
+
+            if (c.points.empty())
+                return false;
+
+            std::sort(c.points.begin(), c.points.end(),
+                      [] (const Point& a, const Point& b) { return a.seconds < b.seconds; });
+
+            result = std::move(c);
+            return true;
+        }
+
+        float valueAt(double seconds) const
+        {
+            if (seconds <= points.front().seconds)
+                return points.front().value;
+
+            for (size_t i = 1; i < points.size(); ++i)
+            {
+                const auto& a = points[i - 1];
+                const auto& b = points[i];
+                if (seconds < b.seconds)
+                {
+                    const double t = (seconds - a.seconds) / juce::jmax(1.0e-9, b.seconds - a.seconds);
+                    return a.value + (float) t * (b.value - a.value);
+                }
+            }
+
+            return points.back().value;
+        }
+
+    private:
+        struct Point
+        {
+            double seconds = 0.0;
+            float value = 0.0f;
+        };
+
+        std::vector<Point> points;
+    };
+
+    struct RenderSettings
+    {
+        juce::String presetName;
+        AmountCurve amount = AmountCurve::constant(1.0f);
+        int blockSize = kDefaultBlockSize;
+        double tailSeconds = 0.0;
+        juce::String outputFormat; // "wav", "aiff" or empty to keep the input format
+        juce::File outputDir;
+    };
+
+    struct RenderResult
+    {
+        bool ok = false;
+        juce::String error;
+        double audioSeconds = 0.0;
+        double wallSeconds = 0.0;
+    };
+
+    // Owns one processor per worker thread so that construction (APVTS, factory preset
+    // check) happens once on the main thread instead of once per file.
+    class ProcessorPool
+    {
+    public:
+        explicit ProcessorPool(int size)
+        {
+            for (int i = 0; i < size; ++i)
+                idle.add(new TheRocketAudioProcessor());
+        }
+
+        TheRocketAudioProcessor* acquire()
+        {
+            const juce::ScopedLock sl(lock);
+            return idle.removeAndReturn(idle.size() - 1);
+        }
+
+        void release(TheRocketAudioProcessor* p)
+        {
+            const juce::ScopedLock sl(lock);
+            idle.add(p);
+        }
+
+    private:
+        juce::CriticalSection lock;
+        juce::OwnedArray<TheRocketAudioProcessor> idle;
+    };
+
+    struct RenderTotals
+    {
+        void add(const RenderResult& r)
+        {
+            const juce::ScopedLock sl(lock);
+            if (r.ok)
+            {
+                audioSeconds += r.audioSeconds;
+                cpuSeconds += r.wallSeconds;
+            }
+            else
+            {
+                ++failures;
+            }
+        }
+
+        juce::CriticalSection lock;
+        double audioSeconds = 0.0;
+        double cpuSeconds = 0.0;
+        int failures = 0;
+    };
+
+    RenderResult renderFile(TheRocketAudioProcessor& processor, const juce::File& inFile, const RenderSettings& settings)
+    {
+        RenderResult result;
+
+        juce::AudioFormatManager formats;
+        formats.registerBasicFormats();
+
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(inFile));
+        if (reader == nullptr)
+        {
+            result.error = "unsupported or unreadable file";
+            return result;
+        }
+
+        const auto extension = settings.outputFormat.isNotEmpty() ? "." + settings.outputFormat
+                                                                  : inFile.getFileExtension();
+        auto* format = formats.findFormatForFileExtension(extension);
+        if (format == nullptr)
+        {
+            result.error = "no writer for " + extension;
+            return result;
+        }
+
+        const auto outFile = settings.outputDir.getChildFile(inFile.getFileNameWithoutExtension() + extension);
+        outFile.deleteFile();
+
+        auto outStream = outFile.createOutputStream();
+        if (outStream == nullptr)
+        {
+            result.error = "cannot write " + outFile.getFullPathName();
+            return result;
+        }
+
+        const double sampleRate = reader->sampleRate;
+        const int numChannels = 2;
+        const int bitsPerSample = juce::jmax(16, (int) reader->bitsPerSample);
+
+        std::unique_ptr<juce::AudioFormatWriter> writer(
+            format->createWriterFor(outStream.get(), sampleRate, (unsigned int) numChannels, bitsPerSample, {}, 0));
+        if (writer == nullptr)
+        {
+            result.error = "cannot create " + format->getFormatName() + " writer";
+            return result;
+        }
+        outStream.release(); // the writer owns the stream now
+
+        // Reset everything a previous file may have left behind
+        if (settings.presetName.isNotEmpty())
+            processor.getPresetManager().loadPreset(settings.presetName);
+
+        processor.setNonRealtime(true);
+        processor.setPlayConfigDetails(numChannels, numChannels, sampleRate, settings.blockSize);
+        processor.prepareToPlay(sampleRate, settings.blockSize);
+        processor.getFxChain().reset();
+
+        auto* amountParam = processor.getAPVTS().getParameter("amount");
+
+        const juce::int64 inputLength = reader->lengthInSamples;
+        const juce::int64 totalLength = inputLength + (juce::int64) (settings.tailSeconds * sampleRate);
+
+        juce::AudioBuffer<float> buffer(numChannels, settings.blockSize);
+        juce::MidiBuffer midi;
+
+        const auto start = juce::Time::getMillisecondCounterHiRes();
+
+        for (juce::int64 pos = 0; pos < totalLength; pos += settings.blockSize)
+        {
+            const int numSamples = (int) juce::jmin((juce::int64) settings.blockSize, totalLength - pos);
+            juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), numChannels, numSamples);
+            block.clear();
+
+            if (pos < inputLength)
+            {
+                const int toRead = (int) juce::jmin((juce::int64) numSamples, inputLength - pos);
+                reader->read(&block, 0, toRead, pos, true, true);
+
+                if (reader->numChannels == 1)
+                    block.copyFrom(1, 0, block, 0, 0, toRead);
+            }
+
+            if (amountParam != nullptr)
+            {
+                const float amount = settings.amount.valueAt((double) pos / sampleRate);
+                amountParam->setValueNotifyingHost(amountParam->convertTo0to1(amount));
+            }
+
+            processor.processBlock(block, midi);
+
+            if (!writer->writeFromAudioSampleBuffer(block, 0, numSamples))
+            {
+                result.error = "write failed";
+                return result;
+            }
+        }
+
+        processor.releaseResources();
+
+        result.wallSeconds = (juce::Time::getMillisecondCounterHiRes() - start) * 0.001;
+        result.audioSeconds = (double) totalLength / sampleRate;
+        result.ok = true;
+        return result;
+    }
+
+    class RenderJob : public juce::ThreadPoolJob
+    {
+    public:
+        RenderJob(ProcessorPool& poolIn, const juce::File& fileIn, const RenderSettings& settingsIn, RenderTotals& totalsIn)
+            : juce::ThreadPoolJob(fileIn.getFileName()),
+              pool(poolIn), file(fileIn), settings(settingsIn), totals(totalsIn)
+        {
+        }
+
+        JobStatus runJob() override
+        {
+            auto* processor = pool.acquire();
+            const auto r = renderFile(*processor, file, settings);
+            pool.release(processor);
+            totals.add(r);
+
+            if (!r.ok)
+            {
+                printLine("FAILED  " + file.getFileName() + ": " + r.error);
+                return jobHasFinished;
+            }
+
+            printLine("rendered " + file.getFileName()
+                      + "  " + juce::String(r.audioSeconds, 2) + " s audio in "
+                      + juce::String(r.wallSeconds, 3) + " s  ("
+                      + juce::String(r.audioSeconds / juce::jmax(1.0e-9, r.wallSeconds), 1) + "x realtime)");
+            return jobHasFinished;
+        }
+
+    private:
+        ProcessorPool& pool;
+        juce::File file;
+        const RenderSettings& settings;
+        RenderTotals& totals;
+    };
+
+    juce::Array<juce::File> collectInputs(const juce::File& input)
+    {
+        juce::Array<juce::File> files;
+
+        if (input.isDirectory())
+        {
+            for (const auto& entry : juce::RangedDirectoryIterator(input, false, "*.wav;*.aif;*.aiff", juce::File::findFiles))
+                files.add(entry.getFile());
+
+            files.sort();
+        }
+        else if (input.existsAsFile())
+        {
+            files.add(input);
+        }
+
+        return files;
+    }
+
+    void runRender(const juce::ArgumentList& args)
+    {
+        const auto input = args.getExistingFileForOption("--in");
+        const auto files = collectInputs(input);
+        if (files.isEmpty())
+            juce::ConsoleApplication::fail("No WAV/AIFF input found at " + input.getFullPathName());
+
+        RenderSettings settings;
+
+        settings.outputDir = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--out"));
+        if (!args.containsOption("--out") || !settings.outputDir.createDirectory())
+            juce::ConsoleApplication::fail("Missing or unwritable --out=<directory>");
+
+        if (args.containsOption("--curve"))
+        {
+            if (!AmountCurve::parse(args.getValueForOption("--curve"), settings.amount))
+                juce::ConsoleApplication::fail("Invalid --curve (expected a file or \"sec:value,sec:value,...\")");
+        }
+        else if (args.containsOption("--amount"))
+        {
+            settings.amount = AmountCurve::constant(args.getValueForOption("--amount").getFloatValue());
+        }
+
+        if (args.containsOption("--block"))
+            settings.blockSize = juce::jlimit(16, 8192, args.getValueForOption("--block").getIntValue());
+
+        if (args.containsOption("--tail"))
+            settings.tailSeconds = juce::jmax(0.0, args.getValueForOption("--tail").getDoubleValue());
+
+        if (args.containsOption("--format"))
+        {
+            settings.outputFormat = args.getValueForOption("--format").toLowerCase();
+            if (settings.outputFormat != "wav" && settings.outputFormat != "aiff")
+                juce::ConsoleApplication::fail("--format must be wav or aiff");
+        }
+
+        int numThreads = juce::SystemStats::getNumCpus();
+        if (args.containsOption("--threads"))
+            numThreads = args.getValueForOption("--threads").getIntValue();
+        numThreads = juce::jlimit(1, juce::jmax(1, files.size()), numThreads);
+
+        ProcessorPool processors(numThreads);
+
+        if (args.containsOption("--preset"))
+        {
+            settings.presetName = args.getValueForOption("--preset");
+
+            auto* probe = processors.acquire();
+            const bool known = probe->getPresetManager().getPresetNames().contains(settings.presetName);
+            processors.release(probe);
+
+            if (!known)
+                juce::ConsoleApplication::fail("Unknown preset \"" + settings.presetName + "\"");
+        }
+
+        printLine("Rendering " + juce::String(files.size()) + " file(s) on " + juce::String(numThreads) + " thread(s)");
+
+        RenderTotals totals;
+        const auto start = juce::Time::getMillisecondCounterHiRes();
+
+        {
+            juce::ThreadPool pool(numThreads);
+            for (const auto& f : files)
+                pool.addJob(new RenderJob(processors, f, settings, totals), true);
+
+            while (pool.getNumJobs() > 0)
+                juce::Thread::sleep(20);
+        }
+
+        const double wall = (juce::Time::getMillisecondCounterHiRes() - start) * 0.001;
+
+        printLine("Done: " + juce::String(totals.audioSeconds, 2) + " s of audio in " + juce::String(wall, 2) + " s wall");
+        printLine("  aggregate: " + juce::String(totals.audioSeconds / juce::jmax(1.0e-9, wall), 1) + "x realtime");
+        printLine("  per core:  " + juce::String(totals.audioSeconds / juce::jmax(1.0e-9, totals.cpuSeconds), 1) + "x realtime");
+
+        if (totals.failures > 0)
+            juce::ConsoleApplication::fail(juce::String(totals.failures) + " file(s) failed");
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand("--help|-h", "The Rocket headless renderer", false);
+    app.addDefaultCommand({ "",
+                            "--in=<file|dir> --out=<dir> [--preset=<name>] [--amount=<0..1> | --curve=<file|sec:val,...>] "
+                            "[--threads=<n>] [--block=<samples>] [--tail=<seconds>] [--format=wav|aiff]",
+                            "Renders WAV/AIFF files through The Rocket",
+                            "Processes every WAV/AIFF file in --in (or the single file) with the given preset and Amount "
+                            "value or automation curve, writing results to --out. Files are spread across a thread pool "
+                            "and per-file and per-core realtime factors are reported.",
+                            runRender });
+
+    return app.findAndRunCommand(argc, argv);
+}
@@ -0,0 +1,360 @@
+#include <JuceHeader.h>
+#include "../PluginProcessor.h"
+
+#if ! JUCE_LINUX
+ #error "TheRocket_RTCheck relies on glibc symbol interposition and only builds on Linux"
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <unistd.h>
+
+// =============================================================================
+// TheRocket_RTCheck - real-time safety gate
+//
+// Runs processBlock through every factory preset with random automation, block
+// sizes, and concurrent preset switches and module reordering. malloc/free (and
+// friends), operator new/delete and pthread mutex locks are interposed; any call
+// made from inside processBlock prints a stack trace and fails the run.
+// =============================================================================
+namespace rtcheck
+{
+    static thread_local bool inAudioCallback = false;
+    static thread_local bool reporting = false;
+
+    std::atomic<int> violations { 0 };
+    constexpr int kMaxReportedTraces = 16;
+
+    void writeStderr(const char* text) noexcept
+    {
+        const auto unused = ::write(STDERR_FILENO, text, std::strlen(text));
+        juce::ignoreUnused(unused);
+    }
+
+    // Must not allocate or lock: only write(2) and backtrace_symbols_fd are used.
+    void reportViolation(const char* what) noexcept
+    {
+        reporting = true;
+
+        const int count = violations.fetch_add(1) + 1;
+        if (count <= kMaxReportedTraces)
+        {
+            writeStderr("\n*** Real-time violation inside processBlock: ");
+            writeStderr(what);
+            writeStderr("\n");
+
+            void* frames[64];
+            const int numFrames = ::backtrace(frames, 64);
+            ::backtrace_symbols_fd(frames, numFrames, STDERR_FILENO);
+        }
+
+        reporting = false;
+    }
+
+    inline void check(const char* what) noexcept
+    {
+        if (inAudioCallback && ! reporting)
+            reportViolation(what);
+    }
+
+    struct ScopedAudioCallback
+    {
+        ScopedAudioCallback() noexcept { inAudioCallback = true; }
+        ~ScopedAudioCallback() noexcept { inAudioCallback = false; }
+    };
+
+    // backtrace() loads libgcc lazily and allocates on its first call; do that up front.
+    void warmUpBacktrace()
+    {
+        void* frames[4];
+        ::backtrace(frames, 4);
+    }
+
+    // The real pthread mutex entry points, looked up past this executable. glibc 2.34+ only
+    // keeps __pthread_mutex_lock as a compat symbol, so it cannot be linked against directly.
+    using MutexFunction = int (*)(pthread_mutex_t*);
+
+    MutexFunction resolveNext(const char* name) noexcept
+    {
+        return reinterpret_cast<MutexFunction>(::dlsym(RTLD_NEXT, name));
+    }
+
+    // Resolved during static initialisation, long before the first checked block; the lazy
+    // lookup only covers locks taken by other static initialisers that run earlier.
+    MutexFunction realMutexLock = resolveNext("pthread_mutex_lock");
+    MutexFunction realMutexTrylock = resolveNext("pthread_mutex_trylock");
+}
+
+// =============================================================================
+// Interposed C allocation and locking entry points
+// =============================================================================
+extern "C"
+{
+    void* __libc_malloc(size_t);
+    void __libc_free(void*);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void* __libc_memalign(size_t, size_t);
+
+    void* malloc(size_t size) noexcept
+    {
+        rtcheck::check("malloc");
+        return __libc_malloc(size);
+    }
+
+    void free(void* ptr) noexcept
+    {
+        if (ptr != nullptr)
+            rtcheck::check("free");
+        __libc_free(ptr);
+    }
+
+    void* calloc(size_t count, size_t size) noexcept
+    {
+        rtcheck::check("calloc");
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* ptr, size_t size) noexcept
+    {
+        rtcheck::check("realloc");
+        return __libc_realloc(ptr, size);
+    }
+
+    void* memalign(size_t alignment, size_t size) noexcept
+    {
+        rtcheck::check("memalign");
+        return __libc_memalign(alignment, size);
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size) noexcept
+    {
+        rtcheck::check("aligned_alloc");
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** result, size_t alignment, size_t size) noexcept
+    {
+        rtcheck::check("posix_memalign");
+        auto* ptr = __libc_memalign(alignment, size);
+        if (ptr == nullptr)
+            return ENOMEM;
+        *result = ptr;
+        return 0;
+    }
+
+    int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+    {
+        rtcheck::check("pthread_mutex_lock");
+        if (rtcheck::realMutexLock == nullptr)
+            rtcheck::realMutexLock = rtcheck::resolveNext("pthread_mutex_lock");
+        return rtcheck::realMutexLock(mutex);
+    }
+
+    int pthread_mutex_trylock(pthread_mutex_t* mutex) noexcept
+    {
+        rtcheck::check("pthread_mutex_trylock");
+        if (rtcheck::realMutexTrylock == nullptr)
+            rtcheck::realMutexTrylock = rtcheck::resolveNext("pthread_mutex_trylock");
+        return rtcheck::realMutexTrylock(mutex);
+    }
+}
+
+// =============================================================================
+// Replaced global operator new/delete (aligned forms fall through to aligned_alloc/free)
+// =============================================================================
+namespace rtcheck
+{
+    void* checkedNew(std::size_t size, const char* what)
+    {
+        check(what);
+        if (auto* ptr = __libc_malloc(size == 0 ? 1 : size))
+            return ptr;
+        throw std::bad_alloc();
+    }
+
+    void* checkedNewNoThrow(std::size_t size, const char* what) noexcept
+    {
+        check(what);
+        return __libc_malloc(size == 0 ? 1 : size);
+    }
+
+    void checkedDelete(void* ptr, const char* what) noexcept
+    {
+        if (ptr != nullptr)
+            check(what);
+        __libc_free(ptr);
+    }
+}
+
+void* operator new(std::size_t size)                                   { return rtcheck::checkedNew(size, "operator new"); }
+void* operator new[](std::size_t size)                                 { return rtcheck::checkedNew(size, "operator new[]"); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept   { return rtcheck::checkedNewNoThrow(size, "operator new"); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return rtcheck::checkedNewNoThrow(size, "operator new[]"); }
+void operator delete(void* ptr) noexcept                               { rtcheck::checkedDelete(ptr, "operator delete"); }
+void operator delete[](void* ptr) noexcept                             { rtcheck::checkedDelete(ptr, "operator delete[]"); }
+void operator delete(void* ptr, std::size_t) noexcept                  { rtcheck::checkedDelete(ptr, "operator delete"); }
+void operator delete[](void* ptr, std::size_t) noexcept                { rtcheck::checkedDelete(ptr, "operator delete[]"); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept        { rtcheck::checkedDelete(ptr, "operator delete"); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept      { rtcheck::checkedDelete(ptr, "operator delete[]"); }
+
+// =============================================================================
+// Harness
+// =============================================================================
+namespace
+{
+    constexpr int kNumChannels = 2;
+
+    void randomiseParameters(TheRocketAudioProcessor& processor, juce::Random& rng, int count)
+    {
+        const auto& ids = processor.getParameterIDs();
+        for (int i = 0; i < count; ++i)
+            if (auto* p = processor.getAPVTS().getParameter(ids[rng.nextInt(ids.size())]))
+                p->setValueNotifyingHost(rng.nextFloat());
+    }
+
+    void runCheck(const juce::ArgumentList& args)
+    {
+        const double secondsPerPreset = args.containsOption("--seconds")
+                                          ? juce::jmax(0.1, args.getValueForOption("--seconds").getDoubleValue())
+                                          : 2.0;
+        const int passes = args.containsOption("--passes")
+                             ? juce::jmax(1, args.getValueForOption("--passes").getIntValue())
+                             : 2;
+        const double sampleRate = args.containsOption("--rate")
+                                    ? args.getValueForOption("--rate").getDoubleValue()
+                                    : 48000.0;
+        const int maxBlockSize = args.containsOption("--block")
+                                   ? juce::jlimit(16, 8192, args.getValueForOption("--block").getIntValue())
+                                   : 512;
+
+        rtcheck::warmUpBacktrace();
+
+        TheRocketAudioProcessor processor;
+        processor.setPlayConfigDetails(kNumChannels, kNumChannels, sampleRate, maxBlockSize);
+        processor.prepareToPlay(sampleRate, maxBlockSize);
+
+        auto& presetManager = processor.getPresetManager();
+        const auto presetNames = PresetManager::getFactoryPresetNames();
+
+        // Preset loads from either thread below are serialised, as they would be on the message thread
+        std::mutex presetMutex;
+        std::atomic<int> presetSwitches { 0 };
+
+        auto switchPreset = [&] (const juce::String& presetName)
+        {
+            const std::lock_guard<std::mutex> lock(presetMutex);
+            presetManager.loadPreset(presetName);
+            processor.notifyPresetLoaded();
+            presetSwitches.fetch_add(1);
+        };
+
+        // Reorder modules from another thread the whole time, as the developer panel would
+        std::atomic<bool> running { true };
+        std::atomic<int> reorders { 0 };
+        std::thread reorderThread ([&]
+        {
+            juce::Random rng(7);
+            while (running.load())
+            {
+                const int numModules = processor.getFxChain().getModuleOrder().size();
+                processor.getFxChain().moveModule(rng.nextInt(numModules), rng.nextInt(numModules));
+                reorders.fetch_add(1);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+
+        // Switch presets from a third thread, so loads land while processBlock is running
+        std::thread presetThread ([&]
+        {
+            juce::Random rng(11);
+            while (running.load())
+            {
+                switchPreset(presetNames[rng.nextInt(presetNames.size())]);
+                std::this_thread::sleep_for(std::chrono::milliseconds(5 + rng.nextInt(46)));
+            }
+        });
+
+        juce::AudioBuffer<float> storage(kNumChannels, maxBlockSize);
+        juce::MidiBuffer midi;
+        juce::Random rng(42);
+        juce::int64 blocks = 0;
+
+        for (int pass = 0; pass < passes; ++pass)
+        {
+            for (const auto& presetName : presetNames)
+            {
+                std::cout << "Pass " << (pass + 1) << "/" << passes << ": " << presetName << std::endl;
+
+                switchPreset(presetName);
+
+                const auto samplesToRun = (juce::int64) (secondsPerPreset * sampleRate);
+                for (juce::int64 done = 0; done < samplesToRun;)
+                {
+                    // Host-side work happens outside the checked region
+                    const int numSamples = rng.nextInt(juce::Range<int>(1, maxBlockSize + 1));
+                    juce::AudioBuffer<float> block(storage.getArrayOfWritePointers(), kNumChannels, numSamples);
+
+                    for (int ch = 0; ch < kNumChannels; ++ch)
+                        for (int i = 0; i < numSamples; ++i)
+                            block.setSample(ch, i, (rng.nextFloat() * 2.0f - 1.0f) * 0.5f);
+
+                    if (rng.nextInt(4) == 0)
+                        randomiseParameters(processor, rng, 1 + rng.nextInt(4));
+
+                    {
+                        const rtcheck::ScopedAudioCallback audioCallback;
+                        processor.processBlock(block, midi);
+                    }
+
+                    done += numSamples;
+                    ++blocks;
+                }
+            }
+        }
+
+        running.store(false);
+        reorderThread.join();
+        presetThread.join();
+
+        const int violations = rtcheck::violations.load();
+        std::cout << std::endl
+                  << "Blocks:          " << blocks << std::endl
+                  << "Preset switches: " << presetSwitches.load() << std::endl
+                  << "Reorders:        " << reorders.load() << std::endl
+                  << "Violations:      " << violations << std::endl;
+
+        if (violations > 0)
+            juce::ConsoleApplication::fail(juce::String(violations) + " allocation/lock call(s) inside processBlock"
+                                           + (violations > rtcheck::kMaxReportedTraces ? " (first "
+                                              + juce::String(rtcheck::kMaxReportedTraces) + " traced above)" : ""));
+
+        std::cout << "PASSED" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand("--help|-h", "The Rocket real-time safety checker", false);
+    app.addDefaultCommand({ "",
+                            "[--seconds=<per preset>] [--passes=<n>] [--rate=<Hz>] [--block=<max samples>]",
+                            "Fails if processBlock allocates, frees or locks a mutex",
+                            "Runs every factory preset with random automation, random block sizes, and concurrent "
+                            "preset switches and module reordering. Each allocation or pthread mutex lock made inside "
+                            "processBlock is reported with a stack trace and the exit code is non-zero.",
+                            runCheck });
+
+    return app.findAndRunCommand(argc, argv);
+}
@@ -0,0 +1,232 @@
+#include "UiAssetCache.h"
+
+namespace
+{
+    struct AssetSource
+    {
+        const char* data;
+        int size;
+    };
+
+    std::array<AssetSource, UiAssetCache::kNumAssets> getAssetSources()
+    {
+        return { { { BinaryData::ui_background_png, BinaryData::ui_background_pngSize },
+                   { BinaryData::ui_clouds_png, BinaryData::ui_clouds_pngSize },
+                   { BinaryData::ui_panel_png, BinaryData::ui_panel_pngSize },
+                   { BinaryData::ui_rocket_png, BinaryData::ui_rocket_pngSize },
+                   { BinaryData::ui_flame_png, BinaryData::ui_flame_pngSize } } };
+    }
+
+    juce::Image resample(const juce::Image& source, juce::Rectangle<int> sourceArea, int width, int height)
+    {
+        juce::Image result(source.getFormat() == juce::Image::RGB ? juce::Image::RGB : juce::Image::ARGB,
+                           width, height, true);
+        juce::Graphics g(result);
+        g.setImageResamplingQuality(juce::Graphics::highResamplingQuality);
+        g.drawImage(source, 0, 0, width, height, sourceArea.getX(), sourceArea.getY(), sourceArea.getWidth(),
+                    sourceArea.getHeight());
+        return result;
+    }
+}
+
+// =============================================================================
+class UiAssetCache::Loader : public juce::Thread
+{
+public:
+    explicit Loader(UiAssetCache& ownerIn) : juce::Thread("Rocket UI Assets"), owner(ownerIn) {}
+    ~Loader() override { stopThread(5000); }
+
+    // Decodes once, then stays around to build the scaled variants editors ask for
+    void run() override
+    {
+        owner.decodeAll();
+
+        while (! threadShouldExit())
+        {
+            owner.buildPending();
+            wait(-1);
+        }
+    }
+
+private:
+    UiAssetCache& owner;
+};
+
+// =============================================================================
+UiAssetCache::UiAssetCache()
+    : loader(std::make_unique<Loader>(*this))
+{
+    loader->startThread();
+}
+
+UiAssetCache::~UiAssetCache()
+{
+    loader.reset();
+}
+
+void UiAssetCache::decodeAll()
+{
+    const auto sources = getAssetSources();
+
+    for (int i = 0; i < kNumAssets; ++i)
+    {
+        if (loader->threadShouldExit())
+            return;
+
+        auto& levels = mips[(size_t) i];
+        levels.clear();
+
+        const auto image = juce::ImageFileFormat::loadFrom(sources[(size_t) i].data, (size_t) sources[(size_t) i].size);
+        if (! image.isValid())
+            continue;
+
+        levels.push_back(image);
+
+        // Each level halves the previous one until the short side reaches kMinMipSize
+        while (juce::jmin(levels.back().getWidth(), levels.back().getHeight()) / 2 >= kMinMipSize)
+        {
+            const auto& previous = levels.back();
+            levels.push_back(resample(previous, previous.getBounds(), previous.getWidth() / 2, previous.getHeight() / 2));
+        }
+    }
+
+    ready.store(true, std::memory_order_release);
+}
+
+juce::Image UiAssetCache::getImage(Asset asset) const
+{
+    if (! isReady())
+        return {};
+
+    const auto& levels = mips[(size_t) asset];
+    return levels.empty() ? juce::Image() : levels.front();
+}
+
+bool UiAssetCache::prepareScaled(const std::vector<ScaledRequest>& requests)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    if (! isReady())
+        return false;
+
+    bool allBuilt = true;
+    {
+        const juce::ScopedLock sl(lock);
+
+        // Never ask for more than fits next to what other editors hold, or entries would evict each other forever
+        const auto count = juce::jmin(requests.size(), kMaxScaledEntries / 2);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto& r = requests[i];
+            const auto key = makeKey(r.asset, r.sourceArea, r.width, r.height);
+            if (! key || scaled.count(*key) != 0)
+                continue;
+
+            allBuilt = false;
+            if (std::find(pending.begin(), pending.end(), *key) == pending.end())
+                pending.push_back(*key);
+        }
+    }
+
+    if (! allBuilt)
+        loader->notify();
+
+    return allBuilt;
+}
+
+juce::Image UiAssetCache::getScaled(Asset asset, juce::Rectangle<int> sourceArea, int width, int height)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    const auto key = makeKey(asset, sourceArea, width, height);
+    if (! key)
+        return {};
+
+    {
+        const juce::ScopedLock sl(lock);
+        if (const auto found = scaled.find(*key); found != scaled.end())
+            return found->second;
+    }
+
+    // Not prepared in advance (a size or display scale the editor did not expect): resample here
+    auto result = resampleFromMips(*key);
+
+    const juce::ScopedLock sl(lock);
+    storeScaled(*key, result);
+    return result;
+}
+
+void UiAssetCache::buildPending()
+{
+    while (! loader->threadShouldExit())
+    {
+        ScaledKey key;
+        {
+            const juce::ScopedLock sl(lock);
+            if (pending.empty())
+                return;
+
+            key = pending.back();
+            pending.pop_back();
+
+            if (scaled.count(key) != 0)
+                continue;
+        }
+
+        // Resampled outside the lock so getScaled() never waits for it
+        const auto image = resampleFromMips(key);
+
+        const juce::ScopedLock sl(lock);
+        storeScaled(key, image);
+    }
+}
+
+std::optional<UiAssetCache::ScaledKey> UiAssetCache::makeKey(Asset asset, juce::Rectangle<int> sourceArea, int width,
+                                                             int height) const
+{
+    if (! isReady() || width <= 0 || height <= 0)
+        return {};
+
+    const auto& levels = mips[(size_t) asset];
+    if (levels.empty())
+        return {};
+
+    sourceArea = sourceArea.getIntersection(levels.front().getBounds());
+    if (sourceArea.isEmpty())
+        return {};
+
+    return ScaledKey { (int) asset, sourceArea.getX(), sourceArea.getY(), sourceArea.getWidth(), sourceArea.getHeight(),
+                       width, height };
+}
+
+// Mip levels are not written again once ready, so this is safe from the loader and the message thread
+juce::Image UiAssetCache::resampleFromMips(const ScaledKey& key) const
+{
+    const auto [asset, x, y, w, h, width, height] = key;
+    const auto& levels = mips[(size_t) asset];
+    const juce::Rectangle<int> sourceArea { x, y, w, h };
+
+    // Smallest mip level that still has at least the requested resolution
+    size_t level = 0;
+    while (level + 1 < levels.size()
+           && sourceArea.getWidth() >> (level + 1) >= width
+           && sourceArea.getHeight() >> (level + 1) >= height)
+        ++level;
+
+    const auto& source = levels[level];
+    const float levelScale = (float) source.getWidth() / (float) levels.front().getWidth();
+    const auto levelArea = sourceArea.toFloat().transformedBy(juce::AffineTransform::scale(levelScale)).getSmallestIntegerContainer()
+                               .getIntersection(source.getBounds());
+
+    return resample(source, levelArea, width, height);
+}
+
+void UiAssetCache::storeScaled(const ScaledKey& key, const juce::Image& image)
+{
+    // Sizes seen by editors are few; dropping everything on overflow keeps this simple and bounded
+    if (scaled.size() >= kMaxScaledEntries)
+        scaled.clear();
+
+    scaled.emplace(key, image);
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+// =============================================================================
+// UiAssetCache - decoded editor artwork shared by every editor in the process
+//
+// Hold it through juce::SharedResourcePointer<UiAssetCache>: the first editor to
+// open creates it and starts decoding the BinaryData PNGs on a background thread,
+// together with a chain of half-size mip levels for each. Each processor also
+// holds a reference from its first createEditor() on, so closing and reopening
+// an editor reuses the decoded images; it is freed with the last such processor.
+// Until isReady() returns true the editor draws without artwork.
+//
+// Scaled variants are resampled from the nearest mip level that is at least as
+// large as the request and kept, so further editors at the same size and display
+// scale reuse the same pixels. An editor hands the variants it expects to draw to
+// prepareScaled(), which has the loader thread build them; getScaled() only
+// resamples on the message thread for sizes nobody asked for in advance.
+// =============================================================================
+class UiAssetCache
+{
+public:
+    enum class Asset
+    {
+        background,
+        clouds,
+        panel,
+        rocket,
+        flame
+    };
+
+    static constexpr int kNumAssets = 5;
+
+    struct ScaledRequest
+    {
+        Asset asset = Asset::background;
+        juce::Rectangle<int> sourceArea;
+        int width = 0, height = 0; // nothing is built while either is zero
+    };
+
+    UiAssetCache();
+    ~UiAssetCache();
+
+    // Any thread.
+    bool isReady() const noexcept { return ready.load(std::memory_order_acquire); }
+
+    // Message thread, once ready: the full-size decoded image (invalid before then).
+    juce::Image getImage(Asset asset) const;
+
+    // Message thread, once ready: queues the variants that are not built yet for the loader thread.
+    // Returns true once all of them are available; call again to poll.
+    bool prepareScaled(const std::vector<ScaledRequest>& requests);
+
+    // Message thread, once ready: sourceArea of the asset resampled to width x height pixels.
+    juce::Image getScaled(Asset asset, juce::Rectangle<int> sourceArea, int width, int height);
+    juce::Image getScaled(const ScaledRequest& r) { return getScaled(r.asset, r.sourceArea, r.width, r.height); }
+
+private:
+    class Loader;
+
+    using ScaledKey = std::tuple<int, int, int, int, int, int, int>; // asset, source area, size
+
+    static constexpr int kMinMipSize = 32;
+    static constexpr size_t kMaxScaledEntries = 64;
+
+    std::array<std::vector<juce::Image>, kNumAssets> mips; // [0] is the decoded original; written by the loader
+    std::atomic<bool> ready { false };
+
+    juce::CriticalSection lock;              // guards the two below
+    std::map<ScaledKey, juce::Image> scaled;
+    std::vector<ScaledKey> pending;          // requested, not yet built by the loader
+
+    std::unique_ptr<Loader> loader;
+
+    void decodeAll();
+    void buildPending();
+    std::optional<ScaledKey> makeKey(Asset asset, juce::Rectangle<int> sourceArea, int width, int height) const;
+    juce::Image resampleFromMips(const ScaledKey& key) const;
+    void storeScaled(const ScaledKey& key, const juce::Image& image); // lock held
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UiAssetCache)
+};